@@ -0,0 +1,67 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   basename.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/10/04 13:02:50 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/10/04 13:02:50 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "loadable_utils.h"
+
+/**
+ * @brief Finds the last component of name, without trailing slashes
+ * @return Its start; *len is set to its length
+ */
+static const char	*last_component(const char *name, size_t *len)
+{
+	size_t	end;
+	size_t	start;
+
+	end = strlen(name);
+	while (end > 1 && name[end - 1] == '/')
+		end--;
+	start = end;
+	while (start > 0 && name[start - 1] != '/')
+		start--;
+	if (start == end && end)
+		start = end - 1;
+	*len = end - start;
+	return (name + start);
+}
+
+/**
+ * @brief basename name [suffix]: prints name without its directories and
+ * without suffix, unless suffix is all that is left
+ */
+int	loadable_basename(char **argv, const t_loadable_ctx *ctx)
+{
+	const char	*base;
+	size_t		len;
+	size_t		suffix_len;
+	char		line[PATH_MAX + 1];
+	int			error;
+
+	if (!argv[1])
+		return (util_error(ctx, "basename", NULL, "missing operand"));
+	if (argv[2] && argv[3])
+		return (util_error(ctx, "basename", argv[3], "extra operand"));
+	base = last_component(argv[1], &len);
+	suffix_len = 0;
+	if (argv[2])
+		suffix_len = strlen(argv[2]);
+	if (suffix_len && suffix_len < len
+		&& !strncmp(base + len - suffix_len, argv[2], suffix_len))
+		len -= suffix_len;
+	if (len > PATH_MAX)
+		len = PATH_MAX;
+	memcpy(line, base, len);
+	line[len++] = '\n';
+	error = util_write_all(ctx->out, line, len);
+	if (error)
+		return (util_fail(ctx, "basename", "write error", error));
+	return (0);
+}
@@ -0,0 +1,73 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cat.c                                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/10/04 10:48:03 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/10/04 10:48:03 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "loadable_utils.h"
+
+/**
+ * @brief Copies fd to ctx->out
+ * @return 0, or the errno of the failed read or write
+ */
+static int	cat_fd(const t_loadable_ctx *ctx, int fd, char *buf)
+{
+	ssize_t	n;
+	int		error;
+
+	n = read(fd, buf, UTIL_BUF_SIZE);
+	while (n > 0)
+	{
+		error = util_write_all(ctx->out, buf, n);
+		if (error)
+			return (error);
+		n = read(fd, buf, UTIL_BUF_SIZE);
+	}
+	if (n < 0)
+		return (errno);
+	return (0);
+}
+
+static int	cat_file(const t_loadable_ctx *ctx, const char *file, char *buf)
+{
+	int	fd;
+	int	error;
+
+	fd = util_open(ctx, file);
+	if (fd < 0)
+		return (util_fail(ctx, "cat", file, errno));
+	error = cat_fd(ctx, fd, buf);
+	util_close(ctx, fd);
+	if (error)
+		return (util_fail(ctx, "cat", file, error));
+	return (0);
+}
+
+/**
+ * @brief cat [file ...]: copies the files, or stdin, to stdout
+ */
+int	loadable_cat(char **argv, const t_loadable_ctx *ctx)
+{
+	char	buf[UTIL_BUF_SIZE];
+	int		status;
+	int		result;
+
+	if (!argv[1])
+		return (cat_file(ctx, "-", buf));
+	status = 0;
+	while (*++argv)
+	{
+		result = cat_file(ctx, *argv, buf);
+		if (result == UTIL_INTERRUPTED)
+			return (result);
+		if (result)
+			status = result;
+	}
+	return (status);
+}
@@ -0,0 +1,140 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   head.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/10/04 11:12:45 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/10/04 11:12:45 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "loadable_utils.h"
+
+/**
+ * @brief Copies the first lines lines of fd to ctx->out
+ * @return 0, or the errno of the failed read or write
+ */
+static int	head_fd(const t_loadable_ctx *ctx, int fd, size_t lines,
+		char *buf)
+{
+	ssize_t	n;
+	size_t	len;
+	int		error;
+
+	while (lines)
+	{
+		n = read(fd, buf, UTIL_BUF_SIZE);
+		if (n < 0)
+			return (errno);
+		if (n == 0)
+			return (0);
+		len = 0;
+		while (len < (size_t)n && lines)
+		{
+			if (buf[len++] == '\n')
+				lines--;
+		}
+		error = util_write_all(ctx->out, buf, len);
+		if (error)
+			return (error);
+	}
+	return (0);
+}
+
+/**
+ * @brief Reads -n N, -nN and -N into lines (10 by default)
+ * @return Index of the first file in argv, or -1 after an error
+ */
+static int	head_options(char **argv, size_t *lines, const t_loadable_ctx *ctx)
+{
+	const char	*count;
+	int			i;
+
+	*lines = 10;
+	i = 1;
+	while (argv[i] && argv[i][0] == '-' && argv[i][1])
+	{
+		if (argv[i][1] == '-' && !argv[i][2])
+			return (i + 1);
+		count = argv[i] + 1;
+		if (argv[i][1] == 'n')
+			count = argv[i] + 2;
+		if (argv[i][1] == 'n' && !argv[i][2])
+			count = argv[++i];
+		if (!count)
+			return (-util_error(ctx, "head", NULL,
+					"option requires an argument -- 'n'"));
+		if (util_parse_size(count, lines))
+			return (-util_error(ctx, "head", count,
+					"invalid number of lines"));
+		i++;
+	}
+	return (i);
+}
+
+/**
+ * @brief Prints "==> file <==", after a blank line unless it is the first
+ */
+static void	head_header(const t_loadable_ctx *ctx, const char *file, int first)
+{
+	if (file[0] == '-' && !file[1])
+		file = "standard input";
+	if (!first)
+		util_write_all(ctx->out, "\n", 1);
+	util_write_all(ctx->out, "==> ", 4);
+	util_write_all(ctx->out, file, strlen(file));
+	util_write_all(ctx->out, " <==\n", 5);
+}
+
+static int	head_file(const t_loadable_ctx *ctx, const char *file, size_t lines,
+		int header)
+{
+	char	buf[UTIL_BUF_SIZE];
+	int		fd;
+	int		error;
+
+	fd = util_open(ctx, file);
+	if (fd < 0)
+		return (util_fail(ctx, "head", file, errno));
+	if (header)
+		head_header(ctx, file, header == 1);
+	error = head_fd(ctx, fd, lines, buf);
+	util_close(ctx, fd);
+	if (error)
+		return (util_fail(ctx, "head", file, error));
+	return (0);
+}
+
+/**
+ * @brief head [-n lines] [file ...]: prints the first lines of each file,
+ * under a header when there are several
+ */
+int	loadable_head(char **argv, const t_loadable_ctx *ctx)
+{
+	size_t	lines;
+	int		header;
+	int		status;
+	int		result;
+	int		i;
+
+	i = head_options(argv, &lines, ctx);
+	if (i < 0)
+		return (1);
+	if (!argv[i])
+		return (head_file(ctx, "-", lines, 0));
+	header = argv[i + 1] != NULL;
+	status = 0;
+	while (argv[i])
+	{
+		result = head_file(ctx, argv[i++], lines, header);
+		if (result == UTIL_INTERRUPTED)
+			return (result);
+		if (result)
+			status = 1;
+		if (header)
+			header = 2;
+	}
+	return (status);
+}
@@ -0,0 +1,71 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   loadable_number.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/10/04 10:31:58 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/10/04 10:31:58 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "loadable_utils.h"
+
+/**
+ * @brief Parses a non-negative decimal count
+ * @return 0 on success, 1 if s is empty, not a number or too large
+ */
+int	util_parse_size(const char *s, size_t *n)
+{
+	size_t	value;
+
+	if (!*s)
+		return (1);
+	value = 0;
+	while (*s >= '0' && *s <= '9')
+	{
+		if (value > ((size_t)-1 - (*s - '0')) / 10)
+			return (1);
+		value = value * 10 + (*s++ - '0');
+	}
+	*n = value;
+	return (*s != '\0');
+}
+
+size_t	util_digits(size_t n)
+{
+	size_t	digits;
+
+	digits = 1;
+	while (n >= 10)
+	{
+		n /= 10;
+		digits++;
+	}
+	return (digits);
+}
+
+/**
+ * @brief Writes n right-aligned in width columns to dst (not terminated)
+ * @return The number of bytes written
+ */
+size_t	util_format(char *dst, size_t n, size_t width)
+{
+	size_t	len;
+	size_t	i;
+
+	len = util_digits(n);
+	if (width < len)
+		width = len;
+	i = 0;
+	while (i < width - len)
+		dst[i++] = ' ';
+	i = width;
+	while (len--)
+	{
+		dst[--i] = '0' + n % 10;
+		n /= 10;
+	}
+	return (width);
+}
@@ -0,0 +1,93 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   loadable_util.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/10/04 10:17:26 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/10/04 10:17:26 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "loadable_utils.h"
+
+/**
+ * @brief Writes all of buf to fd
+ * @return 0, or the errno of the failed write
+ */
+int	util_write_all(int fd, const char *buf, size_t len)
+{
+	ssize_t	n;
+
+	while (len)
+	{
+		n = write(fd, buf, len);
+		if (n < 0)
+			return (errno);
+		buf += n;
+		len -= n;
+	}
+	return (0);
+}
+
+/**
+ * @brief Prints "cmd: arg: message" (or "cmd: message") on ctx->err in a
+ * single write, as the standalone utilities do
+ * @return 1, the status of a failed utility
+ */
+int	util_error(const t_loadable_ctx *ctx, const char *cmd, const char *arg,
+		const char *message)
+{
+	char	line[1024];
+	size_t	len;
+
+	len = strlen(cmd);
+	if (len > 256)
+		len = 256;
+	memcpy(line, cmd, len);
+	line[len++] = ':';
+	line[len++] = ' ';
+	line[len] = '\0';
+	if (arg)
+	{
+		strncat(line, arg, 512);
+		strcat(line, ": ");
+	}
+	strncat(line, message, sizeof(line) - strlen(line) - 2);
+	strcat(line, "\n");
+	util_write_all(ctx->err, line, strlen(line));
+	return (1);
+}
+
+/**
+ * @brief Reports error for arg; an interrupted call (EINTR) or a reader
+ * that is gone (EPIPE) is not reported and gives the status of a command
+ * stopped by SIGINT or SIGPIPE
+ */
+int	util_fail(const t_loadable_ctx *ctx, const char *cmd, const char *arg,
+		int error)
+{
+	if (error == EINTR)
+		return (UTIL_INTERRUPTED);
+	if (error == EPIPE)
+		return (UTIL_BROKEN_PIPE);
+	return (util_error(ctx, cmd, arg, strerror(error)));
+}
+
+/**
+ * @brief Opens file for reading; "-" is ctx->in
+ * @return The fd, or -1 with errno set
+ */
+int	util_open(const t_loadable_ctx *ctx, const char *file)
+{
+	if (file[0] == '-' && !file[1])
+		return (ctx->in);
+	return (open(file, O_RDONLY | O_CLOEXEC));
+}
+
+void	util_close(const t_loadable_ctx *ctx, int fd)
+{
+	if (fd >= 0 && fd != ctx->in)
+		close(fd);
+}
@@ -0,0 +1,83 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   loadable_utils.h                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/10/04 10:05:41 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/10/04 10:05:41 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef LOADABLE_UTILS_H
+# define LOADABLE_UTILS_H
+
+# include <errno.h>
+# include <fcntl.h>
+# include <limits.h>
+# include <stddef.h>
+# include <string.h>
+# include <sys/stat.h>
+# include <unistd.h>
+# include "loadable.h"
+
+/*
+** Sample loadable builtins: basename, cat, head, sleep and wc, built into
+** one shared object (make loadables) and loaded with
+**   enable -f obj/loadables/utils.so basename cat head sleep wc
+** They only use libc and the context the shell passes them.
+*/
+
+# define UTIL_BUF_SIZE 65536
+# define UTIL_INTERRUPTED 130
+# define UTIL_BROKEN_PIPE 141
+
+/* What wc prints */
+# define WC_LINES 1
+# define WC_WORDS 2
+# define WC_BYTES 4
+
+/* Counts of one wc input */
+typedef struct s_wc_count
+{
+	size_t		lines;
+	size_t		words;
+	size_t		bytes;
+}				t_wc_count;
+
+/* One wc run: the counts it prints, their column width and the total */
+typedef struct s_wc
+{
+	int			flags;
+	size_t		width;
+	size_t		inputs;
+	t_wc_count	total;
+}				t_wc;
+
+int			loadable_basename(char **argv, const t_loadable_ctx *ctx);
+int			loadable_cat(char **argv, const t_loadable_ctx *ctx);
+int			loadable_head(char **argv, const t_loadable_ctx *ctx);
+int			loadable_sleep(char **argv, const t_loadable_ctx *ctx);
+int			loadable_wc(char **argv, const t_loadable_ctx *ctx);
+
+/* wc internals */
+int			wc_options(char **argv, t_wc *wc, const t_loadable_ctx *ctx);
+size_t		wc_width(const t_loadable_ctx *ctx, char **names, int flags);
+int			wc_count_fd(int fd, t_wc_count *count, char *buf);
+
+/* I/O shared by the utilities */
+int			util_write_all(int fd, const char *buf, size_t len);
+int			util_error(const t_loadable_ctx *ctx, const char *cmd,
+				const char *arg, const char *message);
+int			util_fail(const t_loadable_ctx *ctx, const char *cmd,
+				const char *arg, int error);
+int			util_open(const t_loadable_ctx *ctx, const char *file);
+void		util_close(const t_loadable_ctx *ctx, int fd);
+
+/* Numbers */
+int			util_parse_size(const char *s, size_t *n);
+size_t		util_format(char *dst, size_t n, size_t width);
+size_t		util_digits(size_t n);
+
+#endif
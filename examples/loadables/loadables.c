@@ -0,0 +1,57 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   loadables.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/10/04 13:41:33 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/10/04 13:41:33 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "loadable_utils.h"
+
+/*
+** The NAME_loadable functions enable -f looks up, one per builtin.
+*/
+
+const t_loadable	*basename_loadable(void)
+{
+	static const t_loadable	desc = {LOADABLE_ABI_VERSION, "basename",
+		loadable_basename, "basename name [suffix]"};
+
+	return (&desc);
+}
+
+const t_loadable	*cat_loadable(void)
+{
+	static const t_loadable	desc = {LOADABLE_ABI_VERSION, "cat",
+		loadable_cat, "cat [file ...]"};
+
+	return (&desc);
+}
+
+const t_loadable	*head_loadable(void)
+{
+	static const t_loadable	desc = {LOADABLE_ABI_VERSION, "head",
+		loadable_head, "head [-n lines] [file ...]"};
+
+	return (&desc);
+}
+
+const t_loadable	*sleep_loadable(void)
+{
+	static const t_loadable	desc = {LOADABLE_ABI_VERSION, "sleep",
+		loadable_sleep, "sleep interval ..."};
+
+	return (&desc);
+}
+
+const t_loadable	*wc_loadable(void)
+{
+	static const t_loadable	desc = {LOADABLE_ABI_VERSION, "wc",
+		loadable_wc, "wc [-lwc] [file ...]"};
+
+	return (&desc);
+}
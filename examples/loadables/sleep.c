@@ -0,0 +1,70 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sleep.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/10/04 13:25:14 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/10/04 13:25:14 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "loadable_utils.h"
+#include <math.h>
+#include <stdlib.h>
+#include <time.h>
+
+/**
+ * @brief Parses an interval such as 2, 0.5 or 1.5m (suffixes s, m, h, d)
+ * @return 0 on success, 1 if arg is not a valid interval
+ */
+static int	parse_interval(const char *arg, double *seconds)
+{
+	char	*end;
+	double	value;
+
+	value = strtod(arg, &end);
+	if (end == arg || !(value >= 0) || isinf(value))
+		return (1);
+	if (*end == 'm')
+		value *= 60;
+	else if (*end == 'h')
+		value *= 60 * 60;
+	else if (*end == 'd')
+		value *= 24 * 60 * 60;
+	else if (*end && *end != 's')
+		return (1);
+	if (*end && end[1])
+		return (1);
+	*seconds += value;
+	return (0);
+}
+
+/**
+ * @brief sleep interval ...: waits for the sum of the intervals
+ * @details A signal that interrupts the wait (SIGINT in an interactive
+ * shell) ends it with status 130, as it would end a sleep process.
+ */
+int	loadable_sleep(char **argv, const t_loadable_ctx *ctx)
+{
+	struct timespec	req;
+	double			seconds;
+
+	if (!argv[1])
+		return (util_error(ctx, "sleep", NULL, "missing operand"));
+	seconds = 0;
+	while (*++argv)
+	{
+		if (parse_interval(*argv, &seconds))
+			return (util_error(ctx, "sleep", *argv,
+					"invalid time interval"));
+	}
+	if (seconds > (double)INT_MAX)
+		seconds = INT_MAX;
+	req.tv_sec = (time_t)seconds;
+	req.tv_nsec = (long)((seconds - req.tv_sec) * 1e9);
+	if (nanosleep(&req, NULL) != 0 && errno == EINTR)
+		return (UTIL_INTERRUPTED);
+	return (0);
+}
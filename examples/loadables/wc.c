@@ -0,0 +1,112 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   wc.c                                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/10/04 12:20:37 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/10/04 12:20:37 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "loadable_utils.h"
+
+/**
+ * @brief Prints the selected counts, then name if there is one, as one
+ * line of "lines words bytes name"
+ */
+static void	wc_print(const t_loadable_ctx *ctx, const t_wc *wc,
+		const t_wc_count *count, const char *name)
+{
+	char	line[96];
+	size_t	len;
+
+	len = 0;
+	if (wc->flags & WC_LINES)
+		len += util_format(line + len, count->lines, wc->width);
+	if ((wc->flags & WC_WORDS) && len)
+		line[len++] = ' ';
+	if (wc->flags & WC_WORDS)
+		len += util_format(line + len, count->words, wc->width);
+	if ((wc->flags & WC_BYTES) && len)
+		line[len++] = ' ';
+	if (wc->flags & WC_BYTES)
+		len += util_format(line + len, count->bytes, wc->width);
+	if (name)
+		line[len++] = ' ';
+	util_write_all(ctx->out, line, len);
+	if (name)
+		util_write_all(ctx->out, name, strlen(name));
+	util_write_all(ctx->out, "\n", 1);
+}
+
+/**
+ * @brief Counts file, prints its line (named unless it is the implicit
+ * stdin) and adds it to the total
+ */
+static int	wc_file(const t_loadable_ctx *ctx, t_wc *wc, const char *file,
+		int named)
+{
+	char		buf[UTIL_BUF_SIZE];
+	t_wc_count	count;
+	int			fd;
+	int			error;
+
+	wc->inputs++;
+	fd = util_open(ctx, file);
+	if (fd < 0)
+		return (util_fail(ctx, "wc", file, errno));
+	memset(&count, 0, sizeof(count));
+	error = wc_count_fd(fd, &count, buf);
+	util_close(ctx, fd);
+	if (error)
+		return (util_fail(ctx, "wc", file, error));
+	if (!named)
+		file = NULL;
+	wc_print(ctx, wc, &count, file);
+	wc->total.lines += count.lines;
+	wc->total.words += count.words;
+	wc->total.bytes += count.bytes;
+	return (0);
+}
+
+static int	wc_stdin(const t_loadable_ctx *ctx, t_wc *wc)
+{
+	char	*names[2];
+
+	names[0] = "-";
+	names[1] = NULL;
+	wc->width = wc_width(ctx, names, wc->flags);
+	return (wc_file(ctx, wc, "-", 0));
+}
+
+/**
+ * @brief wc [-lwc] [file ...]: prints the line, word and byte counts of
+ * each file, or of stdin, and their total when there are several files
+ */
+int	loadable_wc(char **argv, const t_loadable_ctx *ctx)
+{
+	t_wc	wc;
+	int		status;
+	int		result;
+	int		i;
+
+	i = wc_options(argv, &wc, ctx);
+	if (i < 0)
+		return (1);
+	if (!argv[i])
+		return (wc_stdin(ctx, &wc));
+	wc.width = wc_width(ctx, argv + i, wc.flags);
+	status = 0;
+	while (argv[i])
+	{
+		result = wc_file(ctx, &wc, argv[i++], 1);
+		if (result == UTIL_INTERRUPTED)
+			return (result);
+		status |= result;
+	}
+	if (wc.inputs > 1)
+		wc_print(ctx, &wc, &wc.total, "total");
+	return (status);
+}
@@ -0,0 +1,127 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   wc_count.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/10/04 11:46:09 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/10/04 11:46:09 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "loadable_utils.h"
+
+static int	wc_flag(char c, int *flags, const t_loadable_ctx *ctx)
+{
+	char	message[24];
+
+	if (c == 'l')
+		*flags |= WC_LINES;
+	else if (c == 'w')
+		*flags |= WC_WORDS;
+	else if (c == 'c')
+		*flags |= WC_BYTES;
+	else
+	{
+		memcpy(message, "invalid option -- 'x'", 22);
+		message[19] = c;
+		return (util_error(ctx, "wc", NULL, message));
+	}
+	return (0);
+}
+
+/**
+ * @brief Starts a wc run: reads -l, -w and -c (also combined, as -lw)
+ * into wc->flags; without any, all three are printed
+ * @return Index of the first file in argv, or -1 after an error
+ */
+int	wc_options(char **argv, t_wc *wc, const t_loadable_ctx *ctx)
+{
+	const char	*opt;
+	int			i;
+
+	memset(wc, 0, sizeof(*wc));
+	i = 1;
+	while (argv[i] && argv[i][0] == '-' && argv[i][1]
+		&& !(argv[i][1] == '-' && !argv[i][2]))
+	{
+		opt = argv[i++];
+		while (*++opt)
+		{
+			if (wc_flag(*opt, &wc->flags, ctx))
+				return (-1);
+		}
+	}
+	if (argv[i] && argv[i][0] == '-' && argv[i][1] == '-')
+		i++;
+	if (!wc->flags)
+		wc->flags = WC_LINES | WC_WORDS | WC_BYTES;
+	return (i);
+}
+
+/**
+ * @brief Column width as GNU wc computes it: wide enough for the total
+ * size of the regular files, at least 7 if an input is not one, and 1 for
+ * a single count of a single input
+ */
+size_t	wc_width(const t_loadable_ctx *ctx, char **names, int flags)
+{
+	struct stat	st;
+	size_t		total;
+	size_t		width;
+	int			ok;
+
+	if ((flags == WC_LINES || flags == WC_WORDS || flags == WC_BYTES)
+		&& !names[1])
+		return (1);
+	total = 0;
+	width = 1;
+	while (*names)
+	{
+		if ((*names)[0] == '-' && !(*names)[1])
+			ok = fstat(ctx->in, &st) == 0;
+		else
+			ok = stat(*names, &st) == 0;
+		if (ok && S_ISREG(st.st_mode))
+			total += st.st_size;
+		else if (ok)
+			width = 7;
+		names++;
+	}
+	if (util_digits(total) > width)
+		width = util_digits(total);
+	return (width);
+}
+
+/**
+ * @brief Adds the lines, words and bytes of fd to count
+ * @return 0, or the errno of the failed read
+ */
+int	wc_count_fd(int fd, t_wc_count *count, char *buf)
+{
+	ssize_t	n;
+	ssize_t	i;
+	int		in_word;
+	int		space;
+
+	in_word = 0;
+	n = read(fd, buf, UTIL_BUF_SIZE);
+	while (n > 0)
+	{
+		count->bytes += n;
+		i = 0;
+		while (i < n)
+		{
+			count->lines += buf[i] == '\n';
+			space = buf[i] == ' ' || (buf[i] >= '\t' && buf[i] <= '\r');
+			count->words += !in_word && !space;
+			in_word = !space;
+			i++;
+		}
+		n = read(fd, buf, UTIL_BUF_SIZE);
+	}
+	if (n < 0)
+		return (errno);
+	return (0);
+}
@@ -0,0 +1,59 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arena.h                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/21 16:03:44 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/09/21 16:03:44 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#ifndef ARENA_H
+# define ARENA_H
+
+# include <stddef.h>
+
+/* Bump allocator for everything that lives exactly as long as one line */
+# define ARENA_BLOCK_SIZE 65536
+/* Blocks a reset keeps for the next line, in block sizes; a long line's
+   blocks beyond that are freed */
+# define ARENA_KEEP_BLOCKS 4
+# define ARENA_ALIGN 16
+/* Block header, padded so every allocation is ARENA_ALIGN'ed */
+# define ARENA_HEADER 32
+
+/* Build with ARENA_DEBUG=1 to malloc every allocation (for valgrind) */
+# ifndef ARENA_DEBUG
+#  define ARENA_DEBUG 0
+# endif
+
+typedef struct s_arena_block
+{
+	struct s_arena_block	*next;
+	size_t					cap;
+	size_t					used;
+}							t_arena_block;
+
+/* block_size 0 means ARENA_BLOCK_SIZE */
+typedef struct s_arena
+{
+	t_arena_block			*head;
+	t_arena_block			*cur;
+	size_t					block_size;
+}							t_arena;
+
+void						*arena_alloc(t_arena *arena, size_t size);
+char						*arena_strdup(t_arena *arena, const char *s);
+char						*arena_strndup(t_arena *arena, const char *s,
+								size_t len);
+void						arena_reset(t_arena *arena);
+void						arena_destroy(t_arena *arena);
+
+/* Internal helpers shared by the arena sources */
+void						*arena_debug_alloc(t_arena *arena, size_t size);
+void						arena_free_blocks(t_arena_block *block);
+
+#endif
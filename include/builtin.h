@@ -14,14 +14,55 @@
 # define BUILTIN_H
 
 # include "minishell.h"
+# include "cmd.h"
 
 /* Forward declaration */
 typedef struct s_shell	t_shell;
 typedef struct s_cmd	t_cmd;
 
+/* Size of the builtin name hash; see builtin_lookup */
+# define BUILTIN_HASH_SIZE 16
+
+typedef int				(*t_builtin_fn)(char **argv, t_shell *shell);
+
+/* Builtin flags. IN_PARENT builtins change the shell itself: they run in
+   it when they are a pipeline of their own and in a child inside a longer
+   one. IN_PIPELINE builtins leave the shell as it is and run in it as a
+   pipeline stage too */
+# define BUILTIN_IN_PARENT 1
+# define BUILTIN_IN_PIPELINE 2
+
+/* Builtin descriptor */
+typedef struct s_builtin
+{
+	const char			*name;
+	t_builtin_fn		run;
+	int					flags;
+}						t_builtin;
+
+/* Builtin loaded by enable -f: its descriptor in the shared object and the
+   handle that keeps the object mapped */
+typedef struct s_loaded
+{
+	const t_loadable	*desc;
+	void				*handle;
+}						t_loaded;
+
+typedef struct s_loadables
+{
+	t_loaded			*items;
+	size_t				count;
+	size_t				cap;
+}						t_loadables;
+
 /* Built-in detection and execution */
-int						is_builtin(const char *command);
+const t_builtin			*builtin_get(t_builtin_id id);
+t_builtin_id			builtin_lookup(const char *name);
+int						is_builtin(const char *command, t_shell *shell);
+int						builtin_run(t_cmd *cmd, t_shell *shell);
 int						execute_builtin_in_child(t_cmd *cmd, t_shell *shell);
+int						builtin_flush(t_shell *shell, const char *name,
+							int status);
 
 /* Built-in command implementations */
 int						builtin_echo(char **argv, t_shell *shell);
@@ -31,6 +72,24 @@ int						builtin_export(char **argv, t_shell *shell);
 int						builtin_unset(char **argv, t_shell *shell);
 int						builtin_env(char **argv, t_shell *shell);
 int						builtin_exit(char **argv, t_shell *shell);
+int						builtin_stats(char **argv, t_shell *shell);
+void					stats_print_stages(t_shell *shell);
+int						builtin_hash(char **argv, t_shell *shell);
+int						builtin_type(char **argv, t_shell *shell);
+int						builtin_enable(char **argv, t_shell *shell);
+int						builtin_set(char **argv, t_shell *shell);
+
+/* Builtins loaded from shared objects */
+const t_loadable		*loadable_find(const t_loadables *table,
+							const char *name);
+int						loadable_add(t_loadables *table,
+							const t_loadable *desc, void *handle);
+int						loadable_remove(t_loadables *table, const char *name);
+void					loadable_clear(t_loadables *table);
+int						loadable_open(t_shell *shell, const char *file,
+							const char *name);
+int						loadable_run(const t_loadable *desc, char **argv,
+							t_shell *shell);
 
 /* Environment utilities */
 int						env_set_var(t_shell *shell, const char *name,
@@ -38,14 +97,6 @@ int						env_set_var(t_shell *shell, const char *name,
 int						env_unset_var(t_shell *shell, const char *name);
 int						is_valid_var_name(const char *name);
 
-/* Environment helpers */
-char					*create_env_var(const char *name, const char *value);
-int						update_existing_var(t_shell *shell, const char *name,
-							char *new_var);
-int						find_var_index(t_shell *shell, const char *name);
-int						copy_env_without_var(t_shell *shell, const char *name,
-							char **new_envp);
-
 /* Export helpers */
 void					print_exported_vars(t_shell *shell);
 char					*extract_var_name(const char *arg);
@@ -13,6 +13,8 @@
 #ifndef CMD_H
 # define CMD_H
 
+# include "arena.h"
+# include "loadable.h"
 # include "tokens.h"
 
 /* Forward declaration */
@@ -24,64 +26,137 @@ typedef enum e_redir_type
 	REDIR_IN,
 	REDIR_OUT,
 	REDIR_APPEND,
-	REDIR_HEREDOC
+	REDIR_HEREDOC,
+	REDIR_DUP_IN,
+	REDIR_DUP_OUT,
+	REDIR_OUT_ALL
 }						t_redir_type;
 
-/* Redirection structure */
+/* Builtin a command's argv[0] names, resolved once after expansion;
+   BUILTIN_LOADABLE for one loaded by enable -f, BUILTIN_NONE for anything
+   else */
+typedef enum e_builtin_id
+{
+	BUILTIN_NONE,
+	BUILTIN_ECHO,
+	BUILTIN_CD,
+	BUILTIN_PWD,
+	BUILTIN_EXPORT,
+	BUILTIN_UNSET,
+	BUILTIN_ENV,
+	BUILTIN_EXIT,
+	BUILTIN_STATS,
+	BUILTIN_HASH,
+	BUILTIN_TYPE,
+	BUILTIN_ENABLE,
+	BUILTIN_SET,
+	BUILTIN_LOADABLE,
+	BUILTIN_COUNT
+}						t_builtin_id;
+
+/* A shell word as written: a span of the input plus the TOKEN_HAS_*
+   flags of the tokens glued into it */
+typedef struct s_word_span
+{
+	const char			*text;
+	size_t				len;
+	int					flags;
+}						t_word_span;
+
+/* Redirection structure: io_fd is the fd it applies to, word the target
+   as written and file its expansion (set when the command is executed);
+   fd holds a built heredoc body; flags as in t_word_span */
 typedef struct s_redir
 {
 	t_redir_type		type;
+	int					io_fd;
+	char				*word;
 	char				*file;
 	int					fd;
 	int					expand;
+	int					flags;
 	struct s_redir		*next;
 }						t_redir;
 
-/* Command structure */
+/* Command structure: nodes, words and strings all live in arena. words
+   holds the arguments as written and word_flags their TOKEN_HAS_* flags;
+   argv is their expansion, built when the command is executed; builtin
+   (with loadable for a loaded one) and path say what argv[0] resolves
+   to: a builtin, or else the program (path NULL for builtins or if not
+   found). A pipeline stage that runs in the shell has in_shell set and
+   keeps its pipe ends in stage_in and stage_out (-1 for none) until it
+   runs */
 typedef struct s_cmd
 {
+	char				**words;
+	unsigned char		*word_flags;
+	size_t				argc;
+	size_t				words_cap;
 	char				**argv;
+	t_builtin_id		builtin;
+	const t_loadable	*loadable;
+	char				*path;
+	int					in_shell;
+	int					stage_in;
+	int					stage_out;
 	t_redir				*redirs;
+	t_redir				*redirs_tail;
 	struct s_cmd		*next;
 	struct s_cmd		*prev;
+	t_arena				*arena;
 }						t_cmd;
 
+/* Operator that follows a pipeline in a command list */
+typedef enum e_list_op
+{
+	LIST_END,
+	LIST_SEQ,
+	LIST_AND,
+	LIST_OR
+}						t_list_op;
+
+/* Command list node: one pipeline, joined to the next by op. timed is
+   the TIME_REPORT_* mode of a pipeline after the time reserved word, 0
+   otherwise; cmds is NULL for a time with no pipeline after it */
+typedef struct s_pipeline
+{
+	t_cmd				*cmds;
+	int					timed;
+	t_list_op			op;
+	struct s_pipeline	*next;
+}						t_pipeline;
+
 /* Parser structure */
 typedef struct s_parser
 {
 	t_lexer				*lexer;
 	t_token				*current_token;
-	t_cmd				*cmd_list;
+	t_pipeline			*list;
 	int					error;
 	t_shell				*shell;
+	t_arena				*arena;
 }						t_parser;
 
 /* Parser functions */
 t_parser				*parser_init(t_lexer *lexer, t_shell *shell);
 void					parser_destroy(t_parser *parser);
-t_cmd					*parser_parse(t_parser *parser);
-int						parser_parse_pipeline(t_parser *parser);
+t_pipeline				*parser_parse(t_parser *parser);
+t_pipeline				*parser_parse_list(t_parser *parser);
+t_cmd					*parser_parse_pipeline(t_parser *parser);
 t_cmd					*parser_parse_command(t_parser *parser);
-int						parser_parse_redirections(t_parser *parser, t_cmd *cmd);
-int						parser_parse_arguments(t_parser *parser, t_cmd *cmd);
 int						parser_parse_single_redir(t_parser *parser, t_cmd *cmd);
 int						parser_parse_single_arg(t_parser *parser, t_cmd *cmd);
-char					*process_single_argument(t_parser *parser);
+int						parser_word_span(t_parser *parser, t_word_span *word);
 
 /* Command functions */
-t_cmd					*init_cmd(void);
-void					cmd_destroy(t_cmd *cmd);
-void					cmd_destroy_list(t_cmd *cmd_list);
-int						cmd_add_arg(t_cmd *cmd, const char *arg);
+t_cmd					*init_cmd(t_arena *arena);
+int						cmd_add_word(t_cmd *cmd, const t_word_span *word);
 int						cmd_add_redir(t_cmd *cmd, t_redir_type type,
-							const char *file);
-int						cmd_add_redir_with_quote(t_cmd *cmd, t_redir_type type,
-							const char *file, t_quote_state quote_state);
+							int io_fd, const t_word_span *word);
 
 /* Redirection functions */
-t_redir					*init_redir(t_redir_type type, const char *file);
-void					redir_destroy(t_redir *redir);
-void					redir_destroy_list(t_redir *redir_list);
+t_redir					*init_redir(t_arena *arena, t_redir_type type,
+							int io_fd, const t_word_span *word);
 
 /* Parser utilities */
 int						parser_advance(t_parser *parser);
@@ -92,10 +167,8 @@ t_redir_type			parser_token_to_redir_type(t_token_type type);
 /* Parser argument helpers */
 int						check_token_spacing(t_parser *parser,
 							size_t last_token_end);
-char					*get_token_value(t_parser *parser);
-char					*process_token_join(t_parser *parser, char *result);
 int						process_additional_tokens(t_parser *parser,
-							char **result, size_t *last_token_end);
+							size_t *last_token_end, int *flags);
 
 /* Integration function */
 int						parse_and_process(const char *input, t_shell *shell);
@@ -0,0 +1,46 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cmd_hash.h                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/28 10:12:40 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/09/28 10:12:40 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#ifndef CMD_HASH_H
+# define CMD_HASH_H
+
+# include <stddef.h>
+# include <stdint.h>
+
+/* Table of PATH lookups, as bash's hash: command name -> resolved path */
+# define CMD_HASH_MIN_BUCKETS 32
+
+typedef struct s_hashed_cmd
+{
+	char				*name;
+	char				*path;
+	uint32_t			hash;
+	size_t				hits;
+	struct s_hashed_cmd	*next;
+}						t_hashed_cmd;
+
+typedef struct s_cmd_hash
+{
+	t_hashed_cmd		**buckets;
+	size_t				n_buckets;
+	size_t				count;
+}						t_cmd_hash;
+
+t_hashed_cmd			*cmd_hash_find(t_cmd_hash *table, const char *name);
+t_hashed_cmd			*cmd_hash_add(t_cmd_hash *table, const char *name,
+							char *path);
+void					cmd_hash_remove(t_cmd_hash *table, const char *name);
+t_hashed_cmd			*cmd_hash_check(t_cmd_hash *table, const char *name);
+void					cmd_hash_clear(t_cmd_hash *table);
+
+#endif
@@ -0,0 +1,59 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env.h                                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/26 09:41:18 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/09/26 09:41:18 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#ifndef ENV_H
+# define ENV_H
+
+# include <stddef.h>
+# include <stdint.h>
+
+# define ENV_EMPTY -1
+# define ENV_GONE -2
+# define ENV_MIN_INDEX 16
+
+/* One variable; entry is "NAME=value", NULL once unset */
+typedef struct s_env_var
+{
+	char			*entry;
+	size_t			name_len;
+	uint32_t		hash;
+}					t_env_var;
+
+/* Environment: vars keep insertion order, index maps hashes to positions
+ * in vars with linear probing. envp is rebuilt from vars only when dirty
+ * and borrows their entries. */
+typedef struct s_env
+{
+	t_env_var		*vars;
+	size_t			n_vars;
+	size_t			count;
+	int32_t			*index;
+	size_t			index_cap;
+	char			**envp;
+	int				dirty;
+}					t_env;
+
+int					env_init(t_env *env, char **envp);
+void				env_destroy(t_env *env);
+t_env_var			*env_find(const t_env *env, const char *name, size_t len);
+const char			*env_get(const t_env *env, const char *name);
+int					env_set(t_env *env, const char *name, const char *value);
+int					env_unset(t_env *env, const char *name);
+char				**env_envp(t_env *env);
+
+/* Internals shared by the env sources */
+uint32_t			env_hash(const char *name, size_t len);
+size_t				env_probe(const t_env *env, const char *name, size_t len);
+int					env_rebuild(t_env *env, size_t live);
+
+#endif
@@ -15,29 +15,26 @@
 
 # include "minishell.h"
 
-/* Forward declaration */
-typedef struct s_shell	t_shell;
+/* Forward declarations */
+typedef struct s_shell		t_shell;
+typedef struct s_expander	t_expander;
 
 /* Executor function prototypes */
-int		execute_command_list(t_cmd *cmd_list, t_shell *shell);
+int		execute_command_list(t_pipeline *list, t_shell *shell);
 int		execute_single_command(t_cmd *cmd, t_shell *shell);
 int		execute_pipeline(t_cmd *cmd_list, t_shell *shell);
 
-/* Built-in command functions (declared in builtin.h) */
-
 /* Command execution */
 void	execute_child_command(t_cmd *cmd, t_shell *shell);
 int		execute_external_in_child(t_cmd *cmd, t_shell *shell);
 char	*find_command_path(const char *command, t_shell *shell);
-int		check_parent_builtin(char *cmd_name);
+void	resolve_command_paths(t_cmd *cmd_list, t_shell *shell);
 int		execute_builtin_with_redirections(t_cmd *cmd, t_shell *shell);
-int		execute_parent_builtin(t_cmd *cmd, t_shell *shell);
+int		execute_builtin_alone(t_cmd *cmd, t_shell *shell);
 
 /* Redirection handling */
 int		process_heredocs(t_redir *redirs, t_shell *shell);
 int		setup_redirections(t_redir *redirs);
-int		handle_input_redirection(const char *file);
-int		handle_heredoc_redirection(const char *delimiter);
 
 /* Pipeline helpers */
 int		execute_pipeline_child(t_cmd *cmd, int *pipe_fds,
@@ -47,12 +44,10 @@ int		execute_pipeline_parent(t_cmd **current, int *pipe_fds,
 
 /* External execution helpers */
 char	*check_absolute_path(const char *command);
-char	*search_path_dirs(const char *command, char **path_dirs);
-
-/* Redirection helpers */
-int		handle_output_redirection(const char *file);
-int		handle_append_redirection(const char *file);
-int		handle_heredoc_redirection(const char *delimiter);
+char	*search_path_dirs(const char *command, const char *path);
+pid_t	fork_command(t_cmd *cmd, t_shell *shell);
+pid_t	spawn_command(t_cmd *cmd, int *pipe_fds, int prev_read_fd,
+			t_shell *shell);
 
 /* Heredoc helpers */
 int		process_heredoc_line(char *line, const char *delimiter, int write_fd);
@@ -63,8 +58,11 @@ int		cleanup_heredoc(int *pipe_fds, int stdin_backup);
 
 /* New heredoc build functions */
 int		build_heredoc_fd(t_redir *r, t_shell *shell);
-int		process_heredoc_line_with_expand(char *line, t_redir *r,
-			int fd, t_shell *shell);
+int		heredoc_open_storage(t_shell *shell);
+int		heredoc_open_memfd(void);
+int		heredoc_open_tmpfile(const char *dir);
+int		heredoc_write_line(t_expander *stream, t_redir *r,
+			const char *line, size_t len);
 int		write_full(int fd, const char *buf, size_t len);
 int		is_delimiter(char *line, char *delimiter);
 
@@ -75,8 +73,17 @@ pid_t	setup_pipeline_process(t_cmd *current, int pipe_fds[2],
 			int prev_read_fd, t_shell *shell);
 int		process_pipeline_heredocs(t_cmd *cmd_list, t_shell *shell);
 
+/* Builtin stages run in the shell */
+void	pipeline_plan_stages(t_cmd *cmd_list);
+int		pipeline_keep_stage(t_cmd **current, int *pipe_fds,
+			int *prev_read_fd);
+void	pipeline_close_stages(t_cmd *cmd_list);
+void	pipeline_run_stages(t_cmd *cmd_list, t_shell *shell);
+
 /* Error handling */
 void	print_command_error(const char *command, const char *error);
+void	print_arg_error(const char *builtin, const char *arg,
+			const char *message);
 int		handle_execution_error(int error_code, const char *command);
 
 /* Utility functions */
@@ -17,37 +17,55 @@
 
 typedef struct s_shell	t_shell;
 
-/* Expander state structure */
+/* Expander state: input is a borrowed span, result is the shell's scratch
+ * buffer, reused from one word to the next. When flush_fd is set the
+ * result is a stream: full buffers are written there instead of grown */
 typedef struct s_expander
 {
-	char				*input;
+	const char			*input;
 	char				*result;
+	size_t				input_len;
 	size_t				input_pos;
 	size_t				result_pos;
 	size_t				result_capacity;
 	t_quote_state		quote_state;
 	t_shell				*shell;
-	int					error;
+	int					flush_fd;
 }						t_expander;
 
+/* Block size of a streaming expander's writes */
+# define EXPAND_STREAM_BLOCK 65536
+
 /* Core expansion functions */
 char					*expand_string(const char *input, t_shell *shell,
 							t_quote_state state);
-int						expand_token(t_token *token, t_shell *shell);
+char					*expand_span(const char *input, size_t len,
+							t_shell *shell, t_quote_state state);
+char					*expand_word(const char *raw, t_shell *shell);
+char					*expand_word_in(t_arena *arena, const char *raw,
+							t_shell *shell);
+char					*expand_word_if_needed(t_arena *arena, char *raw,
+							int flags, t_shell *shell);
 int						expand_command(t_cmd *cmd, t_shell *shell);
 int						expand_command_list(t_cmd *cmd_list, t_shell *shell);
 
 /* Expander lifecycle */
-t_expander				*init_expander(const char *input, t_shell *shell,
-							t_quote_state state);
-void					expander_destroy(t_expander *expander);
-int						expander_expand(t_expander *expander);
-void					expander_set_error(t_expander *expander);
+void					expander_begin(t_expander *expander, t_shell *shell);
+int						expander_feed(t_expander *expander, const char *input,
+							size_t len, t_quote_state state);
+int						expander_finish(t_expander *expander);
+int						expander_stream(t_expander *expander, int fd);
+int						expander_flush(t_expander *expander);
+char					expander_peek(t_expander *expander);
 
-/* Variable resolution */
-char					*resolve_variable(const char *var_name, t_shell *shell);
-char					*resolve_exit_status(t_shell *shell);
-char					*get_env_var(const char *name, t_shell *shell);
+/* Variable resolution (values are borrowed, valid until the next change) */
+const char				*shell_var(t_shell *shell, const char *name,
+							size_t len);
+const char				*shell_status_str(t_shell *shell);
+int						is_valid_var_char(char c);
+const char				*shell_positional(t_shell *shell, const char *name,
+							size_t len);
+int						is_positional_param(char c);
 
 /* Quote handling */
 t_quote_state			update_quote_state(t_quote_state current, char c);
@@ -56,16 +74,16 @@ int						should_expand_in_context(t_quote_state state);
 
 /*String building */
 int						expander_append_char(t_expander *expander, char c);
+int						expander_append_span(t_expander *expander,
+							const char *str, size_t len);
 int						expander_append_string(t_expander *expander,
 							const char *str);
-int						expander_resize_result(t_expander *expander);
+int						expander_reserve(t_expander *expander, size_t extra);
+size_t					expander_scan(const char *s, size_t pos, size_t len,
+							t_quote_state state);
 
 /* Variable parsing */
-char					*parse_variable_name(const char *input, size_t *pos);
-int						is_valid_var_char(char c);
 int						expander_handle_variable(t_expander *expander);
-char					*var_name_alloc(const char *input, size_t start,
-							size_t len);
 int						handle_braced_var(t_expander *expander);
 
 /* Character processing */
@@ -0,0 +1,58 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   loadable.h                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/10/03 14:21:07 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/10/03 14:21:07 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef LOADABLE_H
+# define LOADABLE_H
+
+/*
+** C ABI of the builtins that enable -f loads from shared objects. This
+** header is all a plugin includes: it does not depend on the shell's own
+** structures, which may change between versions.
+**
+** A shared object provides the builtin NAME by exporting a function
+** NAME_loadable that returns its t_loadable, whose abi_version must be
+** LOADABLE_ABI_VERSION. The shell calls run with argv (argv[0] is the name)
+** and a context that lives for the duration of the call. Loaded builtins
+** run inside the shell process: they must return their exit status rather
+** than exit, release what they allocate, write to the fds of the context,
+** and treat EINTR as an interruption (return 130).
+*/
+
+# define LOADABLE_ABI_VERSION 1
+
+/* Suffix of the function that describes a builtin: NAME_loadable */
+# define LOADABLE_SUFFIX "_loadable"
+
+typedef struct s_loadable_ctx
+{
+	int			abi_version;
+	int			in;
+	int			out;
+	int			err;
+	void		*shell;
+	const char	*(*get_var)(void *shell, const char *name);
+	int			(*set_var)(void *shell, const char *name, const char *value);
+}				t_loadable_ctx;
+
+typedef int		(*t_loadable_fn)(char **argv, const t_loadable_ctx *ctx);
+
+typedef struct s_loadable
+{
+	int				abi_version;
+	const char		*name;
+	t_loadable_fn	run;
+	const char		*usage;
+}					t_loadable;
+
+typedef const t_loadable	*(*t_loadable_entry)(void);
+
+#endif
@@ -17,6 +17,7 @@
 # include <dirent.h>
 # include <errno.h>
 # include <fcntl.h>
+# include <limits.h>
 # include <readline/history.h>
 # include <readline/readline.h>
 # include <signal.h>
@@ -35,11 +36,20 @@
 
 // --- Project Headers ---
 # include "builtin.h"
+# include "cmd_hash.h"
 # include "cmd.h"
+# include "env.h"
 # include "exec.h"
+# include "output.h"
 # include "expand.h"
+# include "plan_cache.h"
+# include "redir_plan.h"
 # include "signals.h"
+# include "spawn_files.h"
+# include "stages.h"
+# include "time_report.h"
 # include "tokens.h"
+# include "trace.h"
 
 /* Exit status constants */
 # define EXIT_SUCCESS 0
@@ -50,33 +60,82 @@
 # define CMD_NOT_FOUND 127
 # define CMD_PERMISSION_DENIED 126
 
+/* Non-interactive input buffering */
+# define INPUT_BUFFER_SIZE 65536
+# define INPUT_BUFFER_ALIGN 64
+
+/* Block-buffered line source used when stdin is not a terminal */
+typedef struct s_input
+{
+	int		fd;
+	char	*buf;
+	size_t	cap;
+	size_t	start;
+	size_t	end;
+	size_t	scanned;
+	int		eof;
+	int		owns_fd;
+}			t_input;
+
 /* Shell state structure */
 typedef struct s_shell
 {
-	char	**envp;
-	int		last_status;
-	int		is_interactive;
-	char	*prompt;
-	int		should_exit;
-	int		exit_code;
-	int		stdin_backup;
-	t_cmd	*current_cmd_list;
-}			t_shell;
+	t_env			env;
+	int				last_status;
+	int				is_interactive;
+	char			*prompt;
+	int				should_exit;
+	int				exit_code;
+	int				stdin_backup;
+	t_cmd			*current_cmd_list;
+	t_arena			arena;
+	t_plan_cache	plans;
+	t_cmd_hash		commands;
+	t_loadables		loadables;
+	t_outbuf		out;
+	char			*expand_buf;
+	size_t			expand_cap;
+	int				status_cached;
+	char			status_text[12];
+	size_t			words_expanded;
+	size_t			words_bypassed;
+	t_input			input;
+	char			**pos_args;
+	int				pos_count;
+	char			*pos_joined;
+	char			*pos_count_text;
+	int				command_mode;
+	int				exec_in_place;
+	int				in_stage;
+	int				pipefail;
+	t_stages		stages;
+	t_stages		last_stages;
+	size_t			forks;
+	size_t			spawns;
+	t_trace			trace;
+}					t_shell;
 
 /* Function prototypes */
 int			shell_init(t_shell *shell, char **envp);
+int			shell_setup_mode(t_shell *shell, int argc, char **argv);
 void		shell_cleanup(t_shell *shell);
 int			shell_loop(t_shell *shell);
-char		*read_command_line(void);
+char		*read_command_line(t_shell *sh);
+void		release_command_line(t_shell *sh, char *line);
 void		process_line(char *input, t_shell *sh);
 void		print_error(const char *context, const char *message);
 
-/* Quote processing functions */
-char		*process_quotes(char *str, t_shell *sh);
-int			has_unclosed_quotes(char *str);
+/* Input source functions */
+int			input_open(t_input *in, int fd);
+int			input_open_string(t_input *in, const char *str);
+int			input_at_end(t_input *in);
+char		*input_next_line(t_input *in, size_t *len);
+ssize_t		input_fill(t_input *in);
+void		input_close(t_input *in);
 
 /* Parser initialization functions */
-int			init_lexer_parser(char *processed, t_lexer **lexer,
+int			init_lexer_parser(char *input, t_lexer **lexer,
 				t_parser **parser, t_shell *sh);
+void		report_parse_error(t_parser *parser);
 
 #endif
@@ -0,0 +1,44 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   output.h                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/30 14:02:26 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/09/30 14:02:26 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef OUTPUT_H
+# define OUTPUT_H
+
+# include <stddef.h>
+
+/* Output buffer of one fd: builtins write here and it reaches the fd in
+   blocks of OUT_BUF_SIZE, and at the latest when the builtin returns */
+# define OUT_BUF_SIZE 8192
+
+/* Error lines up to this length go out in a single write */
+# define ERR_LINE_MAX 1024
+
+typedef struct s_outbuf
+{
+	int					fd;
+	int					error;
+	size_t				len;
+	char				data[OUT_BUF_SIZE];
+}						t_outbuf;
+
+void					out_init(t_outbuf *out, int fd);
+void					out_write(t_outbuf *out, const char *s, size_t len);
+void					out_puts(t_outbuf *out, const char *s);
+void					out_putc(t_outbuf *out, char c);
+int						out_flush(t_outbuf *out);
+void					out_putnbr(t_outbuf *out, long n);
+void					out_putseconds(t_outbuf *out, long usec, int precision);
+
+/* Writes the NULL-terminated list of strings to stderr as one line */
+void					write_error_line(const char **parts);
+
+#endif
@@ -0,0 +1,71 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   plan_cache.h                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/24 15:20:41 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/09/24 15:20:41 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#ifndef PLAN_CACHE_H
+# define PLAN_CACHE_H
+
+# include <stdint.h>
+# include "cmd.h"
+
+/* LRU cache of parsed, unexpanded command lists keyed by the raw line */
+# define PLAN_CACHE_DEFAULT_SIZE 64
+# define PLAN_CACHE_MAX_SIZE 65536
+# define PLAN_CACHE_SIZE_VAR "PLAN_CACHE_SIZE"
+# define PLAN_ARENA_BLOCK 1024
+
+/* A cached plan owns the arena its line, nodes and words live in */
+typedef struct s_plan
+{
+	uint64_t			hash;
+	char				*line;
+	size_t				len;
+	t_pipeline			*list;
+	unsigned long		generation;
+	t_arena				arena;
+	struct s_plan		*prev;
+	struct s_plan		*next;
+	struct s_plan		*chain;
+}						t_plan;
+
+typedef struct s_plan_cache
+{
+	t_plan				**buckets;
+	size_t				n_buckets;
+	size_t				capacity;
+	size_t				count;
+	t_plan				*head;
+	t_plan				*tail;
+	unsigned long		generation;
+	size_t				hits;
+	size_t				misses;
+	size_t				evictions;
+	size_t				resize_to;
+}						t_plan_cache;
+
+int						plan_cache_init(t_plan_cache *cache, size_t capacity);
+t_pipeline				*plan_cache_lookup(t_plan_cache *cache,
+							const char *line);
+t_plan					*plan_cache_prepare(t_plan_cache *cache,
+							const char *line);
+void					plan_cache_insert(t_plan_cache *cache, t_plan *plan,
+							t_pipeline *list);
+void					plan_cache_invalidate(t_plan_cache *cache);
+void					plan_cache_remove(t_plan_cache *cache, t_plan *plan);
+void					plan_cache_destroy(t_plan_cache *cache);
+void					plan_free(t_plan *plan);
+size_t					plan_cache_size_from(const char *value);
+void					plan_cache_env_changed(t_plan_cache *cache,
+							const char *name, const char *value);
+void					plan_cache_apply_resize(t_plan_cache *cache);
+
+#endif
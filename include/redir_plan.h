@@ -0,0 +1,71 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   redir_plan.h                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/10/01 10:40:03 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/10/01 10:40:03 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#ifndef REDIR_PLAN_H
+# define REDIR_PLAN_H
+
+/* Redirections name fds 0 to REDIR_FD_MAX, as in POSIX sh; fds the plan
+   opens, moves or saves for itself live from REDIR_FD_BASE up */
+# define REDIR_FD_MAX 9
+# define REDIR_FD_BASE 10
+
+/* Room for one open file per target plus the copies made when sources
+   are moved out of the way */
+# define REDIR_PLAN_FILES 24
+
+/* Meaning of a "N>&word" word that is not an fd number */
+# define REDIR_DUP_CLOSE -1
+# define REDIR_DUP_FILE -2
+
+typedef struct s_redir	t_redir;
+
+/* Final fd table of a command. Bit n of changed is set when fd n is
+   redirected, to source[n] or closed if that is -1. files are the fds
+   the plan opened itself, closed once it is applied; saved[n] keeps the
+   fd n a parent builtin replaced, -1 if it was closed. A failed plan
+   keeps its error as "error_word: error", or "error_fd: error" */
+typedef struct s_redir_plan
+{
+	int					source[REDIR_FD_MAX + 1];
+	int					saved[REDIR_FD_MAX + 1];
+	int					files[REDIR_PLAN_FILES];
+	int					n_files;
+	int					changed;
+	const char			*error_word;
+	const char			*error;
+	int					error_fd;
+}						t_redir_plan;
+
+void					redir_plan_init(t_redir_plan *plan);
+void					redir_plan_pipe(t_redir_plan *plan, int in, int out);
+int						redir_plan_build(t_redir_plan *plan, t_redir *redirs);
+int						redir_plan_add(t_redir_plan *plan, t_redir *redirs);
+int						redir_plan_apply(t_redir_plan *plan);
+int						redir_plan_save(t_redir_plan *plan);
+void					redir_plan_restore(t_redir_plan *plan);
+void					redir_plan_discard(t_redir_plan *plan);
+int						redir_dup_word(const char *word);
+
+/* Fd table bookkeeping */
+void					redir_plan_set(t_redir_plan *plan, int target,
+							int source);
+int						redir_plan_uses(t_redir_plan *plan, int fd);
+int						redir_plan_relocate(t_redir_plan *plan, int fd);
+int						redir_plan_fail(t_redir_plan *plan, const char *word,
+							const char *error);
+void					redir_plan_report(t_redir_plan *plan);
+int						redir_plan_owns(t_redir_plan *plan, int fd);
+int						redir_plan_track(t_redir_plan *plan, int fd);
+int						redir_plan_replace(t_redir_plan *plan, int old,
+							int fd);
+void					redir_plan_release(t_redir_plan *plan, int fd);
+
+#endif
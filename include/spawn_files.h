@@ -0,0 +1,38 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   spawn_files.h                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/10/08 15:31:52 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/10/08 15:31:52 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#ifndef SPAWN_FILES_H
+# define SPAWN_FILES_H
+
+# include <spawn.h>
+
+/* Room for the files the redirections of one spawned command open */
+# define SPAWN_FILES_MAX 8
+
+typedef struct s_redir	t_redir;
+
+/* Files the redirections of a spawned command opened in the shell, closed
+   once it is started. When a step fails, error_word and error are what
+   the command reports, as "error_word: strerror(error)" */
+typedef struct s_spawn_files
+{
+	int					fds[SPAWN_FILES_MAX];
+	int					count;
+	const char			*error_word;
+	int					error;
+}						t_spawn_files;
+
+int						spawn_redirs_supported(t_redir *redir);
+int						spawn_add_redirs(posix_spawn_file_actions_t *actions,
+							t_redir *redir, t_spawn_files *files);
+void					spawn_close_files(t_spawn_files *files);
+
+#endif
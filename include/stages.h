@@ -0,0 +1,73 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   stages.h                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/10/06 09:31:14 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/10/06 09:31:14 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef STAGES_H
+# define STAGES_H
+
+# include <stddef.h>
+# include <sys/resource.h>
+# include <sys/time.h>
+# include <sys/types.h>
+# include <time.h>
+
+/* Room for one status in $PIPESTATUS: up to three digits and a space */
+# define STAGE_STATUS_WIDTH 4
+
+/* Input an in-shell stage reads and discards once it is done, as much as
+   a pipe holds by default */
+# define STAGE_DRAIN_MAX 65536
+
+/* One stage of a pipeline: the child's pid (0 for a stage the shell ran
+   itself), its exit status as $? shows it, when it started and when it
+   was reaped, and the CPU time and peak RSS wait4 reported for it; for a
+   stage the shell ran, the CPU time is what the shell used meanwhile */
+typedef struct s_stage
+{
+	pid_t				pid;
+	int					status;
+	struct timespec		start;
+	struct timespec		end;
+	struct timeval		utime;
+	struct timeval		stime;
+	long				maxrss;
+}						t_stage;
+
+/* Stages of a pipeline in order. running counts the children not reaped
+   yet; text caches the statuses as $PIPESTATUS shows them */
+typedef struct s_stages
+{
+	t_stage				*items;
+	size_t				count;
+	size_t				cap;
+	size_t				running;
+	char				*text;
+	int					text_valid;
+}						t_stages;
+
+typedef struct s_cmd	t_cmd;
+
+int						stages_begin(t_stages *stages, t_cmd *cmd_list);
+t_stage					*stages_add(t_stages *stages);
+t_stage					*stages_reap(t_stages *stages, pid_t pid, int status,
+							const struct rusage *usage);
+void					stages_swap(t_stages *a, t_stages *b);
+void					stages_clear(t_stages *stages);
+
+void					stage_end(t_stage *stage, int status,
+							const struct rusage *usage);
+void					stage_end_self(t_stage *stage, int status,
+							const struct rusage *before);
+int						stages_result(const t_stages *stages, int pipefail);
+const char				*stages_status_str(t_stages *stages);
+long					stage_real_usec(const t_stage *stage);
+
+#endif
@@ -0,0 +1,56 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   time_report.h                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/10/07 10:12:05 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/10/07 10:12:05 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef TIME_REPORT_H
+# define TIME_REPORT_H
+
+# include <time.h>
+# include "output.h"
+# include "stages.h"
+
+/* How a pipeline after the time reserved word reports: with TIMEFORMAT
+   (or bash's default when unset), or with POSIX's format for time -p */
+# define TIME_REPORT_DEFAULT 1
+# define TIME_REPORT_POSIX 2
+
+# define TIMEFORMAT_VAR "TIMEFORMAT"
+# define TIMEFORMAT_DEFAULT "\nreal\t%3lR\nuser\t%3lU\nsys\t%3lS"
+# define TIMEFORMAT_POSIX "real %2R\nuser %2U\nsys %2S"
+
+/* Decimals of a time when the format does not say, and the most it can
+   have: the microseconds wait4 reports */
+# define TIME_PRECISION_DEFAULT 3
+# define TIME_PRECISION_MAX 6
+
+/* Times of a pipeline or one of its stages in microseconds: real time
+   from start to end, user and system time from the rusage of the stages */
+typedef struct s_times
+{
+	long				real;
+	long				user;
+	long				sys;
+}						t_times;
+
+typedef struct s_shell	t_shell;
+
+void					stage_times(const t_stage *stage, t_times *times);
+void					stages_times(const t_stages *stages, t_times *total);
+void					time_put(t_outbuf *out, long usec, int precision,
+							int long_form);
+void					time_put_percent(t_outbuf *out, const t_times *times);
+void					time_put_json(t_outbuf *out, const t_times *times,
+							const t_stages *stages, int precision);
+void					time_report(t_shell *shell, int mode,
+							const struct timespec *start,
+							const t_stages *stages);
+
+#endif
@@ -28,53 +28,113 @@ typedef enum e_token_type
 	TOKEN_REDIR_OUT,
 	TOKEN_REDIR_APPEND,
 	TOKEN_HEREDOC,
+	TOKEN_DUP_IN,
+	TOKEN_DUP_OUT,
+	TOKEN_REDIR_ALL,
+	TOKEN_AND,
+	TOKEN_OR,
+	TOKEN_SEMICOLON,
 	TOKEN_EOF,
 	TOKEN_ERROR
 }					t_token_type;
 
-/* Quote state for tokens */
+/* Quote state for tokens; QUOTE_HEREDOC is the expander's state for
+   heredoc bodies, where quotes are literal */
 typedef enum e_quote_state
 {
 	QUOTE_NONE,
 	QUOTE_SINGLE,
-	QUOTE_DOUBLE
+	QUOTE_DOUBLE,
+	QUOTE_HEREDOC
 }					t_quote_state;
 
-/* Token structure */
+/* What a WORD token needs from the expander; a word with none of these
+   is used exactly as written */
+# define TOKEN_HAS_DOLLAR 1
+# define TOKEN_HAS_BACKSLASH 2
+# define TOKEN_HAS_QUOTE 4
+
+/* Token structure: a span into the lexer input, never a copy; io_fd is
+   the number written before a redirection operator ("2>"), or -1 */
 typedef struct s_token
 {
 	t_token_type	type;
-	char			*value;
+	size_t			start;
 	size_t			length;
 	t_quote_state	quote_state;
+	int				flags;
+	int				io_fd;
 }					t_token;
 
-/* Lexer state structure */
+/* Tokens are carved from fixed-size chunks owned by the lexer */
+# define TOKEN_ARENA_CHUNK 256
+
+typedef struct s_token_chunk
+{
+	struct s_token_chunk	*next;
+	size_t					used;
+	t_token					tokens[TOKEN_ARENA_CHUNK];
+}							t_token_chunk;
+
+/* Lexer state structure (input is borrowed, not copied) */
 typedef struct s_lexer
 {
 	const char		*input;
 	size_t			pos;
 	size_t			len;
+	t_token_chunk	*chunks;
 }					t_lexer;
 
 /* Lexer functions */
 t_lexer				*lexer_init(const char *input);
 void				lexer_destroy(t_lexer *lexer);
 t_token				*lexer_next_token(t_lexer *lexer);
-t_token				*create_token(t_token_type type, const char *value,
-						size_t length);
-t_token				*create_quoted_token(t_token_type type, const char *value,
-						size_t length, t_quote_state quote_state);
-void				token_destroy(t_token *token);
+t_token				*create_token(t_lexer *lexer, t_token_type type,
+						size_t start, size_t length);
+const char			*token_text(t_lexer *lexer, t_token *token);
+
+/* Token arena */
+t_token				*token_arena_alloc(t_lexer *lexer);
+void				token_arena_release(t_lexer *lexer);
 
 /* Tokenizer functions */
 int					tokenize_and_process(const char *input);
 
-/* Helper functions */
+/* Character classes (see lexer_char_class) */
+# define CC_SPACE 1
+# define CC_META 2
+# define CC_QUOTE 4
+# define CC_DOLLAR 8
+
+/* SIMD scanners are only built for x86; other targets use the table */
+# if defined(__x86_64__) || defined(__i386__)
+#  define LEXER_SIMD_X86 1
+# else
+#  define LEXER_SIMD_X86 0
+# endif
+
+/* Returns the index of the next classified byte in s[pos, len), or len */
+typedef size_t		(*t_scan_fn)(const char *s, size_t pos, size_t len);
+
+/* Character classification */
+const unsigned char	*lexer_char_class(void);
 int					is_whitespace(char c);
 int					is_metacharacter(char c);
 int					is_quote(char c);
-char				*lexer_read_word(t_lexer *lexer);
-char				*lexer_read_quoted(t_lexer *lexer, char quote);
+
+/* Delimiter scanning */
+size_t				lexer_scan(const char *s, size_t pos, size_t len);
+size_t				lexer_scan_scalar(const char *s, size_t pos, size_t len);
+size_t				lexer_scan_sse2(const char *s, size_t pos, size_t len);
+size_t				lexer_scan_avx2(const char *s, size_t pos, size_t len);
+t_scan_fn			lexer_scan_best(void);
+const char			*lexer_scan_name(void);
+
+/* Helper functions */
+size_t				lexer_read_word(t_lexer *lexer, int *flags);
+t_token				*lexer_read_operator(t_lexer *lexer);
+int					lexer_read_quoted(t_lexer *lexer, char quote);
+int					lexer_at_redir(t_lexer *lexer);
+t_token				*lexer_read_redir(t_lexer *lexer);
 
 #endif
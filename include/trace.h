@@ -0,0 +1,53 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   trace.h                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/10/08 09:14:52 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/10/08 09:14:52 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef TRACE_H
+# define TRACE_H
+
+# include <sys/types.h>
+# include "output.h"
+
+/* The file a trace is written to, named when the shell starts */
+# define TRACE_VAR "MINISHELL_TRACE"
+
+/* Event phases of the Chrome trace format */
+# define TRACE_BEGIN 'B'
+# define TRACE_END 'E'
+# define TRACE_INSTANT 'i'
+# define TRACE_METADATA 'M'
+
+/* Chrome trace (JSON) of the shell's phases: on is 0 while tracing is
+   off, as in a zeroed shell; fd is the trace file and pid the shell's own,
+   as forked children share the file and must not end it */
+typedef struct s_trace
+{
+	int					on;
+	int					fd;
+	pid_t				pid;
+}						t_trace;
+
+void					trace_open(t_trace *trace, const char *path);
+void					trace_close(t_trace *trace);
+void					trace_put_head(t_outbuf *out, const char *name,
+							char phase, pid_t pid);
+void					trace_put_string(t_outbuf *out, const char *s);
+
+void					trace_event(const t_trace *trace, const char *name,
+							char phase);
+void					trace_child_start(const t_trace *trace, pid_t pid,
+							const char *name);
+void					trace_child_end(const t_trace *trace, pid_t pid,
+							int status);
+void					trace_execve(const t_trace *trace, pid_t pid,
+							const char *path);
+
+#endif
@@ -16,18 +16,25 @@ void	shell_cleanup(t_shell *shell)
 {
 	if (!shell)
 		return ;
+	out_flush(&shell->out);
 	signal_restore_defaults();
-	if (shell->current_cmd_list)
-	{
-		cmd_destroy_list(shell->current_cmd_list);
-		shell->current_cmd_list = NULL;
-	}
-	if (shell->envp)
-	{
-		ft_strarr_free(shell->envp);
-		shell->envp = NULL;
-	}
+	shell->current_cmd_list = NULL;
+	arena_destroy(&shell->arena);
+	plan_cache_destroy(&shell->plans);
+	cmd_hash_clear(&shell->commands);
+	loadable_clear(&shell->loadables);
+	stages_clear(&shell->stages);
+	stages_clear(&shell->last_stages);
+	env_destroy(&shell->env);
+	free(shell->expand_buf);
+	shell->expand_buf = NULL;
+	free(shell->pos_joined);
+	shell->pos_joined = NULL;
+	free(shell->pos_count_text);
+	shell->pos_count_text = NULL;
+	input_close(&shell->input);
 	if (shell->stdin_backup != -1)
 		close(shell->stdin_backup);
 	clear_history();
+	trace_close(&shell->trace);
 }
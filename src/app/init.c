@@ -12,45 +12,40 @@
 
 #include "minishell.h"
 
-static char	**duplicate_env(char **envp)
-{
-	char	**new_envp;
-	int		count;
-	int		i;
-
-	count = 0;
-	while (envp[count])
-		count++;
-	new_envp = malloc(sizeof(char *) * (count + 1));
-	if (!new_envp)
-		return (NULL);
-	i = 0;
-	while (i < count)
-	{
-		new_envp[i] = ft_strdup(envp[i]);
-		if (!new_envp[i])
-		{
-			ft_strarr_free(new_envp);
-			return (NULL);
-		}
-		i++;
-	}
-	new_envp[i] = NULL;
-	return (new_envp);
-}
-
 static int	setup_shell_environment(t_shell *shell, char **envp)
 {
-	shell->envp = duplicate_env(envp);
-	if (!shell->envp)
+	if (env_init(&shell->env, envp))
 	{
 		print_error("initialization", "Failed to copy environment");
 		close(shell->stdin_backup);
 		return (1);
 	}
+	if (!shell->is_interactive && input_open(&shell->input, STDIN_FILENO))
+	{
+		print_error("initialization", "Failed to allocate input buffer");
+		env_destroy(&shell->env);
+		close(shell->stdin_backup);
+		return (1);
+	}
+	if (plan_cache_init(&shell->plans,
+			plan_cache_size_from(getenv(PLAN_CACHE_SIZE_VAR))))
+		plan_cache_init(&shell->plans, 0);
+	trace_open(&shell->trace, getenv(TRACE_VAR));
 	return (0);
 }
 
+/**
+ * @brief Sets the fields that do not start as zero, NULL or empty
+ */
+static void	init_shell_state(t_shell *shell)
+{
+	ft_bzero(shell, sizeof(*shell));
+	shell->last_status = EXIT_SUCCESS;
+	shell->is_interactive = isatty(STDIN_FILENO);
+	shell->prompt = "minishell$ ";
+	out_init(&shell->out, STDOUT_FILENO);
+}
+
 /**
  * @brief Initialises the minishell structure and sets up environment
  * @param shell Pointer to shell structure to initialise
@@ -61,12 +56,7 @@ int	shell_init(t_shell *shell, char **envp)
 {
 	if (!shell || !envp)
 		return (1);
-	shell->last_status = EXIT_SUCCESS;
-	shell->is_interactive = isatty(STDIN_FILENO);
-	shell->prompt = "minishell$ ";
-	shell->should_exit = 0;
-	shell->exit_code = 0;
-	shell->current_cmd_list = NULL;
+	init_shell_state(shell);
 	shell->stdin_backup = dup(STDIN_FILENO);
 	if (shell->stdin_backup == -1)
 	{
@@ -0,0 +1,60 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   input_fill.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/10/08 14:02:11 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/10/08 14:02:11 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Moves the pending bytes to the front of the buffer, doubling its
+ * size first when the pending line already fills it
+ * @return 0 on success, 1 on allocation failure
+ */
+static int	input_make_room(t_input *in)
+{
+	void	*new_buf;
+	size_t	pending;
+
+	pending = in->end - in->start;
+	if (pending == in->cap)
+	{
+		if (posix_memalign(&new_buf, INPUT_BUFFER_ALIGN, in->cap * 2 + 1))
+			return (1);
+		ft_memcpy(new_buf, in->buf + in->start, pending);
+		free(in->buf);
+		in->buf = new_buf;
+		in->cap *= 2;
+	}
+	else if (in->start > 0)
+		ft_memmove(in->buf, in->buf + in->start, pending);
+	in->start = 0;
+	in->end = pending;
+	return (0);
+}
+
+/**
+ * @brief Reads the next block from the descriptor into the buffer
+ * @return Number of bytes read, 0 on EOF, -1 on error
+ */
+ssize_t	input_fill(t_input *in)
+{
+	ssize_t	n;
+
+	if (input_make_room(in))
+		return (-1);
+	n = read(in->fd, in->buf + in->end, in->cap - in->end);
+	while (n < 0 && errno == EINTR && g_signal == 0)
+		n = read(in->fd, in->buf + in->end, in->cap - in->end);
+	if (n <= 0)
+		in->eof = 1;
+	else
+		in->end += n;
+	return (n);
+}
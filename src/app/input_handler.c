@@ -13,53 +13,37 @@
 #include "minishell.h"
 
 /**
- * @brief      Reads a line of input from the user.
- * @details    In interactive mode, displays a prompt and uses readline.
- * In non-interactive mode, reads from stdin without prompt.
- * @return     A dynamically allocated string containing the user's input,
- * or NULL if an EOF is encountered.
- */
-char	*read_command_line(void)
-{
-	char	*line;
-
-	if (isatty(STDIN_FILENO))
-	{
-		line = readline("minishell$ ");
-	}
-	else
-	{
-		line = get_next_line(STDIN_FILENO);
-		if (line && line[ft_strlen(line) - 1] == '\n')
-			line[ft_strlen(line) - 1] = '\0';
-	}
-	return (line);
-}
-
-/**
- * @brief Handles parser lifecycle: init, parse, cleanup
- * @param processed_input Processed input string
+ * @brief Lexes and parses the input line in a single pass
+ * @details The lexer works on spans of the line as read, so the line is
+ * neither pre-scanned for quotes nor copied. Nodes go into arena. The
+ * "parser_parse" trace phase covers the lexing, which the parser drives.
+ * @param input Input line from user
  * @param sh Shell context
+ * @param arena Arena receiving the command list
  * @param parse_status Output parameter for parsing result
  * @return Command list (NULL on failure)
  */
-static t_cmd	*handle_parser_lifecycle(char *processed_input, t_shell *sh,
+static t_pipeline	*parse_line(char *input, t_shell *sh, t_arena *arena,
 		int *parse_status)
 {
 	t_lexer		*lexer;
 	t_parser	*parser;
-	t_cmd		*cmd_list;
+	t_pipeline	*cmd_list;
 	int			parser_error;
 
-	if (init_lexer_parser(processed_input, &lexer, &parser, sh))
+	if (init_lexer_parser(input, &lexer, &parser, sh))
 		return (*parse_status = 1, NULL);
+	parser->arena = arena;
+	trace_event(&sh->trace, "parser_parse", TRACE_BEGIN);
 	cmd_list = parser_parse(parser);
-	parser_error = parser->error;
+	trace_event(&sh->trace, "parser_parse", TRACE_END);
+	parser_error = parser->error || !cmd_list;
+	if (parser_error)
+		report_parse_error(parser);
 	parser_destroy(parser);
 	lexer_destroy(lexer);
-	if (parser_error || !cmd_list)
+	if (parser_error)
 	{
-		print_error("parser", "Syntax error");
 		sh->last_status = EXIT_STATUS_SYNTAX_ERROR;
 		return (*parse_status = 1, NULL);
 	}
@@ -67,55 +51,47 @@ static t_cmd	*handle_parser_lifecycle(char *processed_input, t_shell *sh,
 }
 
 /**
- * @brief Handles parsing pipeline: quotes, lexer, parser, cleanup
- * @param input Input line from user
- * @param sh Shell context
- * @param parse_status Output parameter for parsing result
- * @return Command list (NULL on failure)
+ * @brief Returns the plan for the input line, parsing it only on a cache miss
+ * @details Plans hold raw words and are expanded when run, so a cached plan
+ * stays valid whatever the environment, cwd or $? are. Lines that fail to
+ * parse are not cached. A hit is a "plan_cache_hit" trace event.
  */
-static t_cmd	*parse_user_input(char *input, t_shell *sh, int *parse_status)
+static t_pipeline	*parse_user_input(char *input, t_shell *sh,
+		int *parse_status)
 {
-	char	*processed_input;
-	t_cmd	*cmd_list;
+	t_pipeline	*cmd_list;
+	t_plan		*plan;
 
-	*parse_status = 0;
-	if (has_unclosed_quotes(input))
+	cmd_list = plan_cache_lookup(&sh->plans, input);
+	if (cmd_list)
 	{
-		print_error("syntax", "unclosed quotes");
-		sh->last_status = EXIT_STATUS_SYNTAX_ERROR;
-		*parse_status = 1;
-		return (NULL);
-	}
-	processed_input = process_quotes(input, sh);
-	if (!processed_input)
-	{
-		print_error("quotes", "Failed to process quotes");
-		sh->last_status = EXIT_FAILURE;
-		*parse_status = 1;
-		return (NULL);
+		trace_event(&sh->trace, "plan_cache_hit", TRACE_INSTANT);
+		return (*parse_status = 0, cmd_list);
 	}
-	cmd_list = handle_parser_lifecycle(processed_input, sh, parse_status);
-	free(processed_input);
+	plan = plan_cache_prepare(&sh->plans, input);
+	if (!plan)
+		return (parse_line(input, sh, &sh->arena, parse_status));
+	cmd_list = parse_line(input, sh, &plan->arena, parse_status);
+	if (*parse_status)
+		plan_free(plan);
+	else
+		plan_cache_insert(&sh->plans, plan, cmd_list);
 	return (cmd_list);
 }
 
 /**
- * @brief Handles command execution and cleanup
+ * @brief Handles command execution
+ * @details The command list lives in the shell arena, released with the
+ * rest of the line by process_line, or in a plan owned by the cache.
  * @param cmd_list Command list to execute
  * @param sh Shell context
  * @return Execution status
  */
-static int	execute_and_cleanup(t_cmd *cmd_list, t_shell *sh)
+static int	execute_and_cleanup(t_pipeline *cmd_list, t_shell *sh)
 {
-	int	execution_status;
-
 	if (!cmd_list)
 		return (EXIT_FAILURE);
-	sh->current_cmd_list = cmd_list;
-	execution_status = execute_command_list(cmd_list, sh);
-	sh->current_cmd_list = NULL;
-	cmd_destroy_list(cmd_list);
-	return (execution_status);
+	return (execute_command_list(cmd_list, sh));
 }
 
 /**
@@ -125,11 +101,11 @@ static int	execute_and_cleanup(t_cmd *cmd_list, t_shell *sh)
  */
 void	process_line(char *input, t_shell *sh)
 {
-	t_cmd	*cmd_list;
-	int		parse_status;
+	t_pipeline	*cmd_list;
+	int			parse_status;
 
 	cmd_list = parse_user_input(input, sh, &parse_status);
-	if (parse_status)
-		return ;
-	sh->last_status = execute_and_cleanup(cmd_list, sh);
+	if (!parse_status)
+		sh->last_status = execute_and_cleanup(cmd_list, sh);
+	arena_reset(&sh->arena);
 }
@@ -0,0 +1,90 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   input_source.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/18 10:12:31 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/09/18 10:12:31 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Opens a block-buffered line source on a file descriptor
+ * @param in Input source to initialise
+ * @param fd File descriptor to read from (not owned)
+ * @return 0 on success, 1 on allocation failure
+ */
+int	input_open(t_input *in, int fd)
+{
+	void	*buf;
+
+	ft_bzero(in, sizeof(t_input));
+	in->fd = fd;
+	in->cap = INPUT_BUFFER_SIZE;
+	if (posix_memalign(&buf, INPUT_BUFFER_ALIGN, in->cap + 1))
+		return (1);
+	in->buf = buf;
+	return (0);
+}
+
+static char	*input_take(t_input *in, size_t line_len, size_t skip, size_t *len)
+{
+	char	*line;
+
+	line = in->buf + in->start;
+	line[line_len] = '\0';
+	in->start += line_len + skip;
+	in->scanned = 0;
+	if (len)
+		*len = line_len;
+	return (line);
+}
+
+/**
+ * @brief Returns the next line without its trailing newline
+ * @details The line is a view into the input buffer: it is NUL-terminated
+ * in place and stays valid only until the next call on the same source.
+ * @param in Input source
+ * @param len Optional output for the line length
+ * @return Pointer to the line, or NULL on EOF
+ */
+char	*input_next_line(t_input *in, size_t *len)
+{
+	char	*nl;
+
+	if (!in->buf)
+		return (NULL);
+	while (1)
+	{
+		nl = memchr(in->buf + in->start + in->scanned, '\n',
+				in->end - in->start - in->scanned);
+		if (nl)
+			return (input_take(in, nl - (in->buf + in->start), 1, len));
+		in->scanned = in->end - in->start;
+		if (in->eof || input_fill(in) <= 0)
+			break ;
+	}
+	if (in->end == in->start)
+		return (NULL);
+	return (input_take(in, in->end - in->start, 0, len));
+}
+
+/**
+ * @brief Releases the buffer of an input source, and its fd when owned
+ */
+void	input_close(t_input *in)
+{
+	if (!in)
+		return ;
+	if (in->owns_fd && in->fd >= 0)
+		close(in->fd);
+	in->owns_fd = 0;
+	free(in->buf);
+	in->buf = NULL;
+	in->start = 0;
+	in->end = 0;
+}
@@ -36,8 +36,7 @@ static int	handle_signal_interrupt(t_shell *sh, char *line)
 		g_signal = 0;
 		if (is_empty_or_whitespace(line))
 		{
-			if (line)
-				free(line);
+			release_command_line(sh, line);
 			return (1);
 		}
 	}
@@ -56,7 +55,7 @@ static int	handle_empty_or_signal(t_shell *sh, char *line)
 		return (1);
 	if (is_empty_or_whitespace(line))
 	{
-		free(line);
+		release_command_line(sh, line);
 		return (1);
 	}
 	return (0);
@@ -74,7 +73,7 @@ int	shell_loop(t_shell *sh)
 	while (!sh->should_exit)
 	{
 		restore_stdin_for_readline(sh);
-		line = read_command_line();
+		line = read_command_line(sh);
 		if (!line)
 		{
 			if (isatty(STDIN_FILENO))
@@ -89,8 +88,9 @@ int	shell_loop(t_shell *sh)
 		g_signal = 0;
 		if (sh->is_interactive)
 			add_history(line);
+		sh->exec_in_place = sh->command_mode && input_at_end(&sh->input);
 		process_line(line, sh);
-		free(line);
+		release_command_line(sh, line);
 	}
 	return (sh->last_status);
 }
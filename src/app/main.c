@@ -17,13 +17,17 @@ int	main(int argc, char **argv, char **envp)
 	t_shell	sh;
 	int		exit_status;
 
-	(void)argc;
-	(void)argv;
 	if (shell_init(&sh, envp) != 0)
 	{
 		print_error("initialization", "Failed to initialize shell");
 		return (1);
 	}
+	exit_status = shell_setup_mode(&sh, argc, argv);
+	if (exit_status != 0)
+	{
+		shell_cleanup(&sh);
+		return (exit_status);
+	}
 	exit_status = shell_loop(&sh);
 	shell_cleanup(&sh);
 	if (sh.should_exit && sh.exit_code != 0)
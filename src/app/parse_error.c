@@ -0,0 +1,78 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parse_error.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/30 14:31:07 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/09/30 14:31:07 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Prints "syntax error near unexpected token `op'"; an operator with
+ * a long fd number is cut short, the end of input is reported as newline
+ */
+static void	report_unexpected_token(t_parser *parser, t_token *token)
+{
+	const char	*parts[4];
+	char		text[16];
+	size_t		len;
+
+	len = token->length;
+	if (len > sizeof(text) - 1)
+		len = sizeof(text) - 1;
+	memcpy(text, token_text(parser->lexer, token), len);
+	text[len] = '\0';
+	parts[0] = "minishell: syntax error near unexpected token `";
+	parts[1] = text;
+	if (token->type == TOKEN_EOF)
+		parts[1] = "newline";
+	parts[2] = "'\n";
+	parts[3] = NULL;
+	write_error_line(parts);
+}
+
+/**
+ * @brief Prints the column of the opening quote the lexer could not close
+ */
+static void	report_unclosed_quote(t_parser *parser, t_token *token)
+{
+	const char	*parts[6];
+	char		quote[2];
+	char		*column;
+
+	quote[0] = parser->lexer->input[token->start];
+	quote[1] = '\0';
+	column = ft_itoa((int)token->start + 1);
+	parts[0] = "minishell: syntax: unclosed quote ";
+	parts[1] = quote;
+	parts[2] = " at column ";
+	parts[3] = column;
+	parts[4] = "\n";
+	parts[5] = NULL;
+	if (column)
+		write_error_line(parts);
+	free(column);
+}
+
+/**
+ * @brief Reports why parsing failed
+ * @details The lexer marks an unterminated quote with a TOKEN_ERROR that
+ * starts at the opening quote, so its column can be reported.
+ */
+void	report_parse_error(t_parser *parser)
+{
+	t_token	*token;
+
+	token = parser->current_token;
+	if (token && token->type != TOKEN_ERROR && token->type != TOKEN_WORD)
+		report_unexpected_token(parser, token);
+	else if (!token || token->type != TOKEN_ERROR)
+		print_error("parser", "Syntax error");
+	else
+		report_unclosed_quote(parser, token);
+}
@@ -0,0 +1,125 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   plan_cache.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/24 15:42:07 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/09/24 15:42:07 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "minishell.h"
+
+/* FNV-1a, 64 bit */
+static uint64_t	plan_hash(const char *line, size_t len)
+{
+	uint64_t	hash;
+	size_t		i;
+
+	hash = 14695981039346656037ULL;
+	i = 0;
+	while (i < len)
+	{
+		hash ^= (unsigned char)line[i++];
+		hash *= 1099511628211ULL;
+	}
+	return (hash);
+}
+
+/**
+ * @brief Sets up an empty cache holding up to capacity plans
+ * @details A capacity of 0 disables caching.
+ * @return 0 on success, 1 on allocation failure
+ */
+int	plan_cache_init(t_plan_cache *cache, size_t capacity)
+{
+	ft_bzero(cache, sizeof(t_plan_cache));
+	if (!capacity)
+		return (0);
+	cache->n_buckets = 16;
+	while (cache->n_buckets < capacity * 2)
+		cache->n_buckets *= 2;
+	cache->buckets = ft_calloc(cache->n_buckets, sizeof(t_plan *));
+	if (!cache->buckets)
+		return (1);
+	cache->capacity = capacity;
+	return (0);
+}
+
+static void	plan_touch(t_plan_cache *cache, t_plan *plan)
+{
+	if (plan == cache->head)
+		return ;
+	plan->prev->next = plan->next;
+	if (plan->next)
+		plan->next->prev = plan->prev;
+	else
+		cache->tail = plan->prev;
+	plan->prev = NULL;
+	plan->next = cache->head;
+	cache->head->prev = plan;
+	cache->head = plan;
+}
+
+/**
+ * @brief Returns the cached plan for line and marks it most recently used
+ * @details Plans from an older generation are dropped and count as misses.
+ * @return Command list owned by the cache, or NULL on a miss
+ */
+t_pipeline	*plan_cache_lookup(t_plan_cache *cache, const char *line)
+{
+	t_plan		*plan;
+	size_t		len;
+	uint64_t	hash;
+
+	if (cache->resize_to)
+		plan_cache_apply_resize(cache);
+	if (!cache->capacity)
+		return (NULL);
+	len = ft_strlen(line);
+	hash = plan_hash(line, len);
+	plan = cache->buckets[hash & (cache->n_buckets - 1)];
+	while (plan && (plan->hash != hash || plan->len != len
+			|| ft_memcmp(plan->line, line, len)))
+		plan = plan->chain;
+	if (plan && plan->generation != cache->generation)
+	{
+		plan_cache_remove(cache, plan);
+		plan = NULL;
+	}
+	if (!plan)
+		return (cache->misses++, NULL);
+	cache->hits++;
+	plan_touch(cache, plan);
+	return (plan->list);
+}
+
+/**
+ * @brief Starts a plan for line; the caller parses into plan->arena and
+ * then hands it to plan_cache_insert, or to plan_free on a syntax error
+ * @return New plan, or NULL when caching is disabled or out of memory
+ */
+t_plan	*plan_cache_prepare(t_plan_cache *cache, const char *line)
+{
+	t_plan	*plan;
+
+	if (!cache->capacity)
+		return (NULL);
+	plan = ft_calloc(1, sizeof(t_plan));
+	if (!plan)
+		return (NULL);
+	plan->arena.block_size = PLAN_ARENA_BLOCK;
+	plan->len = ft_strlen(line);
+	plan->hash = plan_hash(line, plan->len);
+	plan->generation = cache->generation;
+	plan->line = arena_strndup(&plan->arena, line, plan->len);
+	if (!plan->line)
+	{
+		plan_free(plan);
+		return (NULL);
+	}
+	return (plan);
+}
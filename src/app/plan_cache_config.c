@@ -0,0 +1,70 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   plan_cache_config.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/24 17:05:33 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/09/24 17:05:33 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "minishell.h"
+
+/**
+ * @brief Parses a PLAN_CACHE_SIZE value
+ * @return The size, PLAN_CACHE_DEFAULT_SIZE when unset or not a number,
+ * capped at PLAN_CACHE_MAX_SIZE; 0 disables the cache
+ */
+size_t	plan_cache_size_from(const char *value)
+{
+	size_t	size;
+	size_t	i;
+
+	if (!value || !*value)
+		return (PLAN_CACHE_DEFAULT_SIZE);
+	size = 0;
+	i = 0;
+	while (ft_isdigit(value[i]) && size <= PLAN_CACHE_MAX_SIZE)
+		size = size * 10 + (value[i++] - '0');
+	if (value[i] && !ft_isdigit(value[i]))
+		return (PLAN_CACHE_DEFAULT_SIZE);
+	if (size > PLAN_CACHE_MAX_SIZE)
+		return (PLAN_CACHE_MAX_SIZE);
+	return (size);
+}
+
+/**
+ * @brief Schedules a resize when PLAN_CACHE_SIZE is exported or unset
+ * @details The resize is applied by the next lookup, since the command
+ * doing the export may itself be running from a cached plan.
+ */
+void	plan_cache_env_changed(t_plan_cache *cache, const char *name,
+		const char *value)
+{
+	if (ft_strcmp((char *)name, PLAN_CACHE_SIZE_VAR) != 0)
+		return ;
+	cache->resize_to = plan_cache_size_from(value) + 1;
+}
+
+/**
+ * @brief Rebuilds the cache with the scheduled size, keeping the counters
+ */
+void	plan_cache_apply_resize(t_plan_cache *cache)
+{
+	size_t	counters[3];
+	size_t	capacity;
+
+	capacity = cache->resize_to - 1;
+	counters[0] = cache->hits;
+	counters[1] = cache->misses;
+	counters[2] = cache->evictions;
+	plan_cache_destroy(cache);
+	if (plan_cache_init(cache, capacity))
+		plan_cache_init(cache, 0);
+	cache->hits = counters[0];
+	cache->misses = counters[1];
+	cache->evictions = counters[2];
+}
@@ -0,0 +1,96 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   plan_cache_lru.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/24 16:18:52 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/09/24 16:18:52 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "minishell.h"
+
+void	plan_free(t_plan *plan)
+{
+	if (!plan)
+		return ;
+	arena_destroy(&plan->arena);
+	free(plan);
+}
+
+/**
+ * @brief Adds a freshly parsed plan as most recently used, evicting the
+ * least recently used one when the cache is full
+ */
+void	plan_cache_insert(t_plan_cache *cache, t_plan *plan, t_pipeline *list)
+{
+	t_plan	**bucket;
+
+	if (cache->count >= cache->capacity && cache->tail)
+	{
+		plan_cache_remove(cache, cache->tail);
+		cache->evictions++;
+	}
+	plan->list = list;
+	bucket = &cache->buckets[plan->hash & (cache->n_buckets - 1)];
+	plan->chain = *bucket;
+	*bucket = plan;
+	plan->prev = NULL;
+	plan->next = cache->head;
+	if (cache->head)
+		cache->head->prev = plan;
+	cache->head = plan;
+	if (!cache->tail)
+		cache->tail = plan;
+	cache->count++;
+}
+
+void	plan_cache_remove(t_plan_cache *cache, t_plan *plan)
+{
+	t_plan	**link;
+
+	link = &cache->buckets[plan->hash & (cache->n_buckets - 1)];
+	while (*link && *link != plan)
+		link = &(*link)->chain;
+	if (*link)
+		*link = plan->chain;
+	if (plan->prev)
+		plan->prev->next = plan->next;
+	else
+		cache->head = plan->next;
+	if (plan->next)
+		plan->next->prev = plan->prev;
+	else
+		cache->tail = plan->prev;
+	cache->count--;
+	plan_free(plan);
+}
+
+/**
+ * @brief Makes every cached plan stale in O(1)
+ * @details Call whenever something that changes how lines are lexed or
+ * parsed changes; stale plans are dropped when next looked up or evicted.
+ */
+void	plan_cache_invalidate(t_plan_cache *cache)
+{
+	cache->generation++;
+}
+
+void	plan_cache_destroy(t_plan_cache *cache)
+{
+	t_plan	*plan;
+	t_plan	*next;
+
+	plan = cache->head;
+	while (plan)
+	{
+		next = plan->next;
+		plan_free(plan);
+		plan = next;
+	}
+	free(cache->buckets);
+	ft_bzero(cache, sizeof(t_plan_cache));
+}
@@ -0,0 +1,79 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   read_line.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/18 10:40:02 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/09/18 10:40:02 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief      Reads a line of input from the user.
+ * @details    In interactive mode, displays a prompt and uses readline.
+ * In non-interactive mode, returns a view into the shell's input buffer.
+ * @param sh   Shell context owning the input source
+ * @return     The line (release it with release_command_line),
+ * or NULL if an EOF is encountered.
+ */
+char	*read_command_line(t_shell *sh)
+{
+	if (sh->is_interactive)
+		return (readline(sh->prompt));
+	return (input_next_line(&sh->input, NULL));
+}
+
+/**
+ * @brief Releases a line obtained from read_command_line
+ * @details Only readline lines are heap allocated; buffered lines are views.
+ */
+void	release_command_line(t_shell *sh, char *line)
+{
+	if (line && sh->is_interactive)
+		free(line);
+}
+
+/**
+ * @brief Opens an input source over an in-memory script (used by -c)
+ * @param in Input source to initialise
+ * @param str Script text, copied so lines can be terminated in place
+ * @return 0 on success, 1 on allocation failure
+ */
+int	input_open_string(t_input *in, const char *str)
+{
+	size_t	len;
+
+	ft_bzero(in, sizeof(t_input));
+	in->fd = -1;
+	len = ft_strlen(str);
+	in->buf = malloc(len + 1);
+	if (!in->buf)
+		return (1);
+	ft_memcpy(in->buf, str, len + 1);
+	in->cap = len;
+	in->end = len;
+	in->eof = 1;
+	return (0);
+}
+
+/**
+ * @brief Tells whether the source holds nothing but blanks and newlines
+ * @details Those would only be skipped as empty lines, so a command read
+ * before them is still the last one.
+ */
+int	input_at_end(t_input *in)
+{
+	size_t	i;
+
+	if (!in->eof)
+		return (0);
+	i = in->start;
+	while (i < in->end && (in->buf[i] == ' ' || in->buf[i] == '\t'
+			|| in->buf[i] == '\n'))
+		i++;
+	return (i == in->end);
+}
@@ -0,0 +1,94 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   shell_mode.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/18 14:22:09 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/09/18 14:22:09 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+static void	switch_to_batch_input(t_shell *shell)
+{
+	if (shell->is_interactive)
+	{
+		shell->is_interactive = 0;
+		signal_setup_non_interactive();
+	}
+	input_close(&shell->input);
+}
+
+/**
+ * @brief Sets up `minishell -c cmdline [name [args...]]`
+ * @return 0 on success, otherwise the exit status to terminate with
+ */
+static int	setup_command_string(t_shell *shell, int argc, char **argv)
+{
+	if (argc < 3)
+	{
+		print_error("-c", "option requires an argument");
+		return (EXIT_STATUS_SYNTAX_ERROR);
+	}
+	switch_to_batch_input(shell);
+	if (input_open_string(&shell->input, argv[2]))
+	{
+		print_error("-c", strerror(errno));
+		return (EXIT_FAILURE);
+	}
+	shell->command_mode = 1;
+	if (argc > 3)
+	{
+		shell->pos_args = argv + 3;
+		shell->pos_count = argc - 3;
+	}
+	return (0);
+}
+
+/**
+ * @brief Sets up `minishell script [args...]`
+ * @return 0 on success, otherwise the exit status to terminate with
+ */
+static int	setup_script_file(t_shell *shell, int argc, char **argv)
+{
+	int	fd;
+
+	fd = open(argv[1], O_RDONLY | O_CLOEXEC);
+	if (fd == -1)
+	{
+		print_error(argv[1], strerror(errno));
+		return (CMD_NOT_FOUND);
+	}
+	switch_to_batch_input(shell);
+	if (input_open(&shell->input, fd))
+	{
+		close(fd);
+		print_error(argv[1], strerror(errno));
+		return (EXIT_FAILURE);
+	}
+	shell->input.owns_fd = 1;
+	shell->pos_args = argv + 1;
+	shell->pos_count = argc - 1;
+	return (0);
+}
+
+/**
+ * @brief Selects the input mode from the command line arguments
+ * @details Without arguments the shell reads stdin (interactive or piped).
+ * `-c cmdline` runs the given string and `script [args]` runs a file, both
+ * non-interactively with the extra words available as $0, $1.. and $#.
+ * @return 0 on success, otherwise the exit status to terminate with
+ */
+int	shell_setup_mode(t_shell *shell, int argc, char **argv)
+{
+	shell->pos_args = argv;
+	shell->pos_count = 1;
+	if (argc < 2)
+		return (0);
+	if (ft_strcmp(argv[1], "-c") == 0)
+		return (setup_command_string(shell, argc, argv));
+	return (setup_script_file(shell, argc, argv));
+}
@@ -14,10 +14,10 @@
 
 int	cd_to_home(t_shell *shell);
 int	cd_to_path(const char *path);
-int	expand_tilde_with_slash(char *path, char *home);
-int	handle_tilde_only(char *home);
+int	expand_tilde_with_slash(char *path, const char *home);
+int	handle_tilde_only(const char *home);
 
-static int	process_tilde_path(char *path, char *home)
+static int	process_tilde_path(char *path, const char *home)
 {
 	int	result;
 
@@ -36,20 +36,17 @@ static int	process_tilde_path(char *path, char *home)
 
 static int	handle_tilde_path(char *path, t_shell *shell)
 {
-	char	*home;
-	int		result;
+	const char	*home;
 
 	if (path[0] != '~')
 		return (cd_to_path(path));
-	home = get_env_var("HOME", shell);
+	home = env_get(&shell->env, "HOME");
 	if (!home)
 	{
 		print_error("cd", "HOME not set");
 		return (1);
 	}
-	result = process_tilde_path(path, home);
-	free(home);
-	return (result);
+	return (process_tilde_path(path, home));
 }
 
 static int	update_pwd_var(t_shell *shell)
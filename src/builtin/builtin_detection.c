@@ -12,23 +12,72 @@
 
 #include "minishell.h"
 
-int	is_builtin(const char *command)
+/**
+ * @brief Returns the descriptor of builtin id, indexed by t_builtin_id
+ * @details Loaded builtins share one entry; cmd->loadable says which.
+ * They may set variables, which only sticks when they run on their own.
+ */
+const t_builtin	*builtin_get(t_builtin_id id)
 {
-	if (!command)
-		return (0);
-	if (ft_strcmp((char *)command, "echo") == 0)
-		return (1);
-	if (ft_strcmp((char *)command, "cd") == 0)
-		return (1);
-	if (ft_strcmp((char *)command, "pwd") == 0)
-		return (1);
-	if (ft_strcmp((char *)command, "export") == 0)
-		return (1);
-	if (ft_strcmp((char *)command, "unset") == 0)
-		return (1);
-	if (ft_strcmp((char *)command, "env") == 0)
-		return (1);
-	if (ft_strcmp((char *)command, "exit") == 0)
-		return (1);
-	return (0);
+	static const t_builtin	table[BUILTIN_COUNT] = {
+	[BUILTIN_NONE] = {NULL, NULL, 0},
+	[BUILTIN_ECHO] = {"echo", builtin_echo, BUILTIN_IN_PIPELINE},
+	[BUILTIN_CD] = {"cd", builtin_cd, BUILTIN_IN_PARENT},
+	[BUILTIN_PWD] = {"pwd", builtin_pwd, BUILTIN_IN_PIPELINE},
+	[BUILTIN_EXPORT] = {"export", builtin_export, BUILTIN_IN_PARENT},
+	[BUILTIN_UNSET] = {"unset", builtin_unset, BUILTIN_IN_PARENT},
+	[BUILTIN_ENV] = {"env", builtin_env, BUILTIN_IN_PIPELINE},
+	[BUILTIN_EXIT] = {"exit", builtin_exit, BUILTIN_IN_PARENT},
+	[BUILTIN_STATS] = {"stats", builtin_stats, BUILTIN_IN_PARENT},
+	[BUILTIN_HASH] = {"hash", builtin_hash, BUILTIN_IN_PARENT},
+	[BUILTIN_TYPE] = {"type", builtin_type, BUILTIN_IN_PIPELINE},
+	[BUILTIN_ENABLE] = {"enable", builtin_enable, BUILTIN_IN_PARENT},
+	[BUILTIN_SET] = {"set", builtin_set, BUILTIN_IN_PARENT},
+	[BUILTIN_LOADABLE] = {NULL, NULL, BUILTIN_IN_PARENT | BUILTIN_IN_PIPELINE}
+	};
+
+	return (&table[id]);
+}
+
+/**
+ * @brief Finds the builtin called name with a single string comparison
+ * @details (length + second byte) % 16 is a perfect hash of the builtin
+ * names. The slots are computed by the compiler from the names, and two
+ * builtins landing in one slot break the build (-Woverride-init), so a
+ * new builtin must keep the hash perfect.
+ */
+t_builtin_id	builtin_lookup(const char *name)
+{
+	static const unsigned char	slots[BUILTIN_HASH_SIZE] = {
+	[(4 + 'c') % BUILTIN_HASH_SIZE] = BUILTIN_ECHO,
+	[(2 + 'd') % BUILTIN_HASH_SIZE] = BUILTIN_CD,
+	[(3 + 'w') % BUILTIN_HASH_SIZE] = BUILTIN_PWD,
+	[(6 + 'x') % BUILTIN_HASH_SIZE] = BUILTIN_EXPORT,
+	[(5 + 'n') % BUILTIN_HASH_SIZE] = BUILTIN_UNSET,
+	[(3 + 'n') % BUILTIN_HASH_SIZE] = BUILTIN_ENV,
+	[(4 + 'x') % BUILTIN_HASH_SIZE] = BUILTIN_EXIT,
+	[(5 + 't') % BUILTIN_HASH_SIZE] = BUILTIN_STATS,
+	[(4 + 'a') % BUILTIN_HASH_SIZE] = BUILTIN_HASH,
+	[(4 + 'y') % BUILTIN_HASH_SIZE] = BUILTIN_TYPE,
+	[(6 + 'n') % BUILTIN_HASH_SIZE] = BUILTIN_ENABLE,
+	[(3 + 'e') % BUILTIN_HASH_SIZE] = BUILTIN_SET
+	};
+	t_builtin_id				id;
+
+	if (!name || !name[0])
+		return (BUILTIN_NONE);
+	id = slots[(ft_strlen(name) + (unsigned char)name[1])
+		% BUILTIN_HASH_SIZE];
+	if (id && ft_strcmp((char *)builtin_get(id)->name, (char *)name) == 0)
+		return (id);
+	return (BUILTIN_NONE);
+}
+
+/**
+ * @brief Tells whether command names a builtin, loaded ones included
+ */
+int	is_builtin(const char *command, t_shell *shell)
+{
+	return (builtin_lookup(command) != BUILTIN_NONE
+		|| loadable_find(&shell->loadables, command));
 }
@@ -33,7 +33,6 @@ int	builtin_echo(char **argv, t_shell *shell)
 	int	i;
 	int	print_newline;
 
-	(void)shell;
 	if (!argv)
 		return (1);
 	i = 1;
@@ -45,12 +44,12 @@ int	builtin_echo(char **argv, t_shell *shell)
 	}
 	while (argv[i])
 	{
-		ft_putstr_fd(argv[i], STDOUT_FILENO);
+		out_puts(&shell->out, argv[i]);
 		if (argv[i + 1])
-			ft_putchar_fd(' ', STDOUT_FILENO);
+			out_putc(&shell->out, ' ');
 		i++;
 	}
 	if (print_newline)
-		ft_putchar_fd('\n', STDOUT_FILENO);
+		out_putc(&shell->out, '\n');
 	return (0);
 }
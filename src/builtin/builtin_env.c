@@ -14,15 +14,20 @@
 
 int	builtin_env(char **argv, t_shell *shell)
 {
-	int	i;
+	char	**envp;
+	int		i;
 
 	(void)argv;
-	if (!shell || !shell->envp)
+	if (!shell)
+		return (1);
+	envp = env_envp(&shell->env);
+	if (!envp)
 		return (1);
 	i = 0;
-	while (shell->envp[i])
+	while (envp[i])
 	{
-		ft_putendl_fd(shell->envp[i], STDOUT_FILENO);
+		out_puts(&shell->out, envp[i]);
+		out_putc(&shell->out, '\n');
 		i++;
 	}
 	return (0);
@@ -12,23 +12,48 @@
 
 #include "minishell.h"
 
+/**
+ * @brief Runs the builtin cmd resolved to, compiled in or loaded
+ */
+int	builtin_run(t_cmd *cmd, t_shell *shell)
+{
+	if (cmd->builtin == BUILTIN_LOADABLE)
+		return (loadable_run(cmd->loadable, cmd->argv, shell));
+	return (builtin_get(cmd->builtin)->run(cmd->argv, shell));
+}
+
+/**
+ * @brief Flushes the output of the builtin name at its end
+ * @details A failed write turns the status into 1 and is reported like
+ * bash does, e.g. "echo: write error: No space left on device". A
+ * pipeline stage run by the shell whose reader is gone ends silently with
+ * the status SIGPIPE gives a child.
+ */
+int	builtin_flush(t_shell *shell, const char *name, int status)
+{
+	int	error;
+
+	error = out_flush(&shell->out);
+	if (!error)
+		return (status);
+	if (error == EPIPE && shell->in_stage)
+		return (EXIT_STATUS_SIGNAL_BASE + SIGPIPE);
+	print_arg_error(name, "write error", strerror(error));
+	return (1);
+}
+
+/**
+ * @brief Runs a builtin in a child and returns the child's exit status;
+ * for exit that is the status it asked for, as in "cmd | exit 3"
+ */
 int	execute_builtin_in_child(t_cmd *cmd, t_shell *shell)
 {
-	if (!cmd || !cmd->argv || !cmd->argv[0] || !shell)
+	int	status;
+
+	if (!cmd || !cmd->argv || !cmd->argv[0] || !shell || !cmd->builtin)
 		return (EXIT_FAILURE);
-	if (ft_strcmp(cmd->argv[0], "echo") == 0)
-		return (builtin_echo(cmd->argv, shell));
-	if (ft_strcmp(cmd->argv[0], "cd") == 0)
-		return (builtin_cd(cmd->argv, shell));
-	if (ft_strcmp(cmd->argv[0], "pwd") == 0)
-		return (builtin_pwd(cmd->argv, shell));
-	if (ft_strcmp(cmd->argv[0], "export") == 0)
-		return (builtin_export(cmd->argv, shell));
-	if (ft_strcmp(cmd->argv[0], "unset") == 0)
-		return (builtin_unset(cmd->argv, shell));
-	if (ft_strcmp(cmd->argv[0], "env") == 0)
-		return (builtin_env(cmd->argv, shell));
-	if (ft_strcmp(cmd->argv[0], "exit") == 0)
-		return (builtin_exit(cmd->argv, shell));
-	return (1);
+	status = builtin_flush(shell, cmd->argv[0], builtin_run(cmd, shell));
+	if (shell->should_exit)
+		return (shell->exit_code);
+	return (status);
 }
@@ -49,7 +49,7 @@ static int	handle_too_many_args(t_shell *shell)
 static void	finalize_exit(t_shell *shell, int exit_code)
 {
 	if (shell->is_interactive)
-		ft_putendl_fd("exit", STDOUT_FILENO);
+		out_puts(&shell->out, "exit\n");
 	shell->should_exit = 1;
 	shell->exit_code = exit_code;
 	shell->last_status = exit_code;
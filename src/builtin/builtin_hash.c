@@ -0,0 +1,108 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_hash.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/28 11:02:19 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/09/28 11:02:19 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "minishell.h"
+
+static void	print_entry(t_outbuf *out, t_hashed_cmd *entry)
+{
+	char	*hits;
+	size_t	len;
+
+	hits = ft_itoa((int)entry->hits);
+	if (!hits)
+		return ;
+	len = ft_strlen(hits);
+	while (len++ < 4)
+		out_putc(out, ' ');
+	out_puts(out, hits);
+	out_putc(out, '\t');
+	out_puts(out, entry->path);
+	out_putc(out, '\n');
+	free(hits);
+}
+
+static void	print_hashed(t_outbuf *out, t_cmd_hash *table)
+{
+	t_hashed_cmd	*entry;
+	size_t			i;
+
+	if (!table->count)
+	{
+		out_puts(out, "hash: hash table empty\n");
+		return ;
+	}
+	out_puts(out, "hits\tcommand\n");
+	i = 0;
+	while (i < table->n_buckets)
+	{
+		entry = table->buckets[i++];
+		while (entry)
+		{
+			print_entry(out, entry);
+			entry = entry->next;
+		}
+	}
+}
+
+/**
+ * @brief Searches PATH for name and hashes the result; builtins and names
+ * with a slash are never hashed
+ */
+static int	hash_name(const char *name, t_shell *shell)
+{
+	char	*path;
+
+	if (is_builtin(name, shell) || ft_strchr(name, '/'))
+		return (0);
+	path = find_command_path(name, shell);
+	if (!path)
+	{
+		print_arg_error("hash", name, "not found");
+		return (1);
+	}
+	if (!cmd_hash_add(&shell->commands, name, path))
+		return (1);
+	return (0);
+}
+
+/**
+ * @brief hash [-r] [name ...]: lists or fills the command hash
+ * @details Without names the table is listed with its hit counts; -r
+ * empties it first. Each name is searched in PATH again.
+ */
+int	builtin_hash(char **argv, t_shell *shell)
+{
+	int	status;
+	int	i;
+
+	i = 1;
+	if (argv[1] && ft_strcmp(argv[1], "-r") == 0)
+	{
+		cmd_hash_clear(&shell->commands);
+		i++;
+	}
+	if (argv[i] && argv[i][0] == '-' && argv[i][1])
+	{
+		print_error("hash", "usage: hash [-r] [name ...]");
+		return (2);
+	}
+	if (i == 1 && !argv[1])
+		print_hashed(&shell->out, &shell->commands);
+	status = 0;
+	while (argv[i])
+	{
+		if (hash_name(argv[i++], shell))
+			status = 1;
+	}
+	return (status);
+}
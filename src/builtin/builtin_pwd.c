@@ -17,14 +17,14 @@ int	builtin_pwd(char **argv, t_shell *shell)
 	char	*cwd;
 
 	(void)argv;
-	(void)shell;
 	cwd = getcwd(NULL, 0);
 	if (!cwd)
 	{
 		print_error("pwd", strerror(errno));
 		return (1);
 	}
-	ft_putendl_fd(cwd, STDOUT_FILENO);
+	out_puts(&shell->out, cwd);
+	out_putc(&shell->out, '\n');
 	free(cwd);
 	return (0);
 }
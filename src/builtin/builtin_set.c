@@ -0,0 +1,59 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_set.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/10/06 13:05:51 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/10/06 13:05:51 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Lists the options as set -o does, or as the set commands that
+ * restore them as set +o does
+ */
+static void	print_options(t_shell *shell, int as_commands)
+{
+	if (as_commands && shell->pipefail)
+		out_puts(&shell->out, "set -o pipefail\n");
+	else if (as_commands)
+		out_puts(&shell->out, "set +o pipefail\n");
+	else if (shell->pipefail)
+		out_puts(&shell->out, "pipefail       \ton\n");
+	else
+		out_puts(&shell->out, "pipefail       \toff\n");
+}
+
+/**
+ * @brief set [-o|+o] [option]: turns a shell option on (-o) or off (+o),
+ * or lists the options
+ * @details pipefail is the only option: a pipeline then returns the
+ * status of its last stage that failed, or 0. Without arguments, set
+ * lists the options as set -o does.
+ */
+int	builtin_set(char **argv, t_shell *shell)
+{
+	int	on;
+
+	on = argv[1] && ft_strcmp(argv[1], "-o") == 0;
+	if (argv[1] && !on && ft_strcmp(argv[1], "+o") != 0)
+	{
+		print_arg_error("set", argv[1], "invalid option");
+		print_error("set", "usage: set [-o|+o] [pipefail]");
+		return (2);
+	}
+	if (!argv[1] || !argv[2])
+		print_options(shell, argv[1] && !on);
+	else if (ft_strcmp(argv[2], "pipefail") == 0)
+		shell->pipefail = on;
+	else
+	{
+		print_arg_error("set", argv[2], "invalid option name");
+		return (2);
+	}
+	return (0);
+}
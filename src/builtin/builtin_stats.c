@@ -0,0 +1,80 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_stats.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/24 17:31:10 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/09/24 17:31:10 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "minishell.h"
+
+static void	print_count(t_outbuf *out, const char *label, size_t count)
+{
+	char	*number;
+
+	number = ft_itoa((int)count);
+	out_puts(out, label);
+	out_puts(out, number);
+	free(number);
+}
+
+static void	stats_reset(t_shell *shell)
+{
+	shell->plans.hits = 0;
+	shell->plans.misses = 0;
+	shell->plans.evictions = 0;
+	shell->words_expanded = 0;
+	shell->words_bypassed = 0;
+	shell->forks = 0;
+	shell->spawns = 0;
+}
+
+static void	stats_print(t_shell *shell)
+{
+	t_plan_cache	*cache;
+	t_outbuf		*out;
+
+	cache = &shell->plans;
+	out = &shell->out;
+	print_count(out, "plan cache: hits ", cache->hits);
+	print_count(out, ", misses ", cache->misses);
+	print_count(out, ", evictions ", cache->evictions);
+	print_count(out, ", entries ", cache->count);
+	print_count(out, "/", cache->capacity);
+	print_count(out, "\nwords: expanded ", shell->words_expanded);
+	print_count(out, ", bypassed ", shell->words_bypassed);
+	print_count(out, "\nprocesses: forked ", shell->forks);
+	print_count(out, ", spawned ", shell->spawns);
+	out_putc(out, '\n');
+}
+
+/**
+ * @brief stats [-r|-c|-p]: prints plan cache, word expansion and process
+ * counters
+ * @details -r resets the counters, -c drops every cached plan, -p prints
+ * the stages of the last pipeline instead.
+ */
+int	builtin_stats(char **argv, t_shell *shell)
+{
+	if (argv[1] && ft_strcmp(argv[1], "-p") == 0)
+	{
+		stats_print_stages(shell);
+		return (0);
+	}
+	if (argv[1] && ft_strcmp(argv[1], "-r") == 0)
+		stats_reset(shell);
+	else if (argv[1] && ft_strcmp(argv[1], "-c") == 0)
+		plan_cache_invalidate(&shell->plans);
+	else if (argv[1])
+	{
+		print_error("stats", "usage: stats [-r|-c|-p]");
+		return (2);
+	}
+	stats_print(shell);
+	return (0);
+}
@@ -0,0 +1,92 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_type.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/28 11:24:51 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/09/28 11:24:51 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "minishell.h"
+
+static void	print_type(t_outbuf *out, const char *name, const char *text,
+		const char *path)
+{
+	out_puts(out, name);
+	out_puts(out, text);
+	out_puts(out, path);
+}
+
+/**
+ * @brief Prints the answer for the time keyword, a builtin or a hashed
+ * command
+ * @return 1 if name was one of them
+ */
+static int	type_known(const char *name, t_shell *shell)
+{
+	t_hashed_cmd	*entry;
+
+	if (!ft_strcmp((char *)name, "time"))
+	{
+		print_type(&shell->out, name, " is a shell keyword\n", NULL);
+		return (1);
+	}
+	if (is_builtin(name, shell))
+	{
+		print_type(&shell->out, name, " is a shell builtin\n", NULL);
+		return (1);
+	}
+	entry = NULL;
+	if (!ft_strchr(name, '/'))
+		entry = cmd_hash_find(&shell->commands, name);
+	if (!entry)
+		return (0);
+	print_type(&shell->out, name, " is hashed (", entry->path);
+	out_puts(&shell->out, ")\n");
+	return (1);
+}
+
+/**
+ * @brief Tells how name would be run, without hashing it
+ */
+static int	type_name(const char *name, t_shell *shell)
+{
+	char	*path;
+
+	if (type_known(name, shell))
+		return (0);
+	path = find_command_path(name, shell);
+	if (!path)
+	{
+		print_arg_error("type", name, "not found");
+		return (1);
+	}
+	print_type(&shell->out, name, " is ", path);
+	out_putc(&shell->out, '\n');
+	free(path);
+	return (0);
+}
+
+/**
+ * @brief type name ...: says whether each name is a keyword, a builtin, a
+ * hashed command or a program in PATH
+ * @return 0 if every name was found, 1 otherwise
+ */
+int	builtin_type(char **argv, t_shell *shell)
+{
+	int	status;
+	int	i;
+
+	status = 0;
+	i = 1;
+	while (argv[i])
+	{
+		if (type_name(argv[i++], shell))
+			status = 1;
+	}
+	return (status);
+}
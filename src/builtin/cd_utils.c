@@ -14,9 +14,9 @@
 
 int	cd_to_home(t_shell *shell)
 {
-	char	*home;
+	const char	*home;
 
-	home = get_env_var("HOME", shell);
+	home = env_get(&shell->env, "HOME");
 	if (!home)
 	{
 		print_error("cd", "HOME not set");
@@ -25,10 +25,8 @@ int	cd_to_home(t_shell *shell)
 	if (chdir(home) == -1)
 	{
 		print_error("cd", strerror(errno));
-		free(home);
 		return (1);
 	}
-	free(home);
 	return (0);
 }
 
@@ -44,7 +42,7 @@ int	cd_to_path(const char *path)
 	return (0);
 }
 
-int	expand_tilde_with_slash(char *path, char *home)
+int	expand_tilde_with_slash(char *path, const char *home)
 {
 	char	*expanded_path;
 	int		result;
@@ -57,7 +55,7 @@ int	expand_tilde_with_slash(char *path, char *home)
 	return (result);
 }
 
-int	handle_tilde_only(char *home)
+int	handle_tilde_only(const char *home)
 {
 	return (cd_to_path(home));
 }
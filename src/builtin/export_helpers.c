@@ -19,22 +19,24 @@ void	print_exported_vars(t_shell *shell)
 	int		i;
 	char	*name;
 	char	*value;
+	char	**envp;
 
-	if (!shell || !shell->envp)
+	if (!shell || !env_envp(&shell->env))
 		return ;
+	envp = shell->env.envp;
 	i = 0;
-	while (shell->envp[i])
+	while (envp[i])
 	{
-		name = ft_strchr(shell->envp[i], '=');
+		name = ft_strchr(envp[i], '=');
 		if (name)
 		{
 			*name = '\0';
 			value = name + 1;
-			ft_putstr_fd("declare -x ", STDOUT_FILENO);
-			ft_putstr_fd(shell->envp[i], STDOUT_FILENO);
-			ft_putstr_fd("=\"", STDOUT_FILENO);
-			ft_putstr_fd(value, STDOUT_FILENO);
-			ft_putendl_fd("\"", STDOUT_FILENO);
+			out_puts(&shell->out, "declare -x ");
+			out_puts(&shell->out, envp[i]);
+			out_puts(&shell->out, "=\"");
+			out_puts(&shell->out, value);
+			out_puts(&shell->out, "\"\n");
 			*name = '=';
 		}
 		i++;
@@ -0,0 +1,113 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   loadable_run.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/10/03 15:20:31 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/10/03 15:20:31 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+#include <dlfcn.h>
+
+static const char	*loadable_get_var(void *shell, const char *name)
+{
+	return (env_get(&((t_shell *)shell)->env, name));
+}
+
+/**
+ * @brief set_var of the context: a NULL value unsets the variable
+ * @details In a pipeline stage run by the shell the change is dropped, as
+ * it would be in a child.
+ */
+static int	loadable_set_var(void *shell, const char *name, const char *value)
+{
+	if (((t_shell *)shell)->in_stage)
+		return (0);
+	if (!value)
+		return (env_unset_var(shell, name));
+	return (env_set_var(shell, name, value));
+}
+
+/**
+ * @brief Calls NAME_loadable from handle and checks the builtin it
+ * describes
+ * @return The descriptor, or NULL after reporting why it cannot be used
+ */
+static const t_loadable	*loadable_symbol(void *handle, const char *name)
+{
+	const t_loadable	*desc;
+	t_loadable_entry	entry;
+	char				*symbol;
+
+	symbol = ft_strjoin(name, LOADABLE_SUFFIX);
+	if (!symbol)
+		return (NULL);
+	entry = (t_loadable_entry)dlsym(handle, symbol);
+	free(symbol);
+	if (!entry)
+	{
+		print_arg_error("enable", "cannot find builtin", dlerror());
+		return (NULL);
+	}
+	desc = entry();
+	if (!desc || desc->abi_version != LOADABLE_ABI_VERSION || !desc->run
+		|| !desc->name || ft_strcmp((char *)desc->name, (char *)name) != 0)
+	{
+		print_arg_error("enable", name, "unsupported loadable builtin");
+		return (NULL);
+	}
+	return (desc);
+}
+
+/**
+ * @brief enable -f file name: loads the builtin name from the shared
+ * object file; compiled-in builtins cannot be replaced
+ * @return 0 on success, 1 after reporting an error
+ */
+int	loadable_open(t_shell *shell, const char *file, const char *name)
+{
+	const t_loadable	*desc;
+	void				*handle;
+
+	if (builtin_lookup(name))
+	{
+		print_arg_error("enable", name, "cannot replace a shell builtin");
+		return (1);
+	}
+	handle = dlopen(file, RTLD_NOW | RTLD_LOCAL);
+	if (!handle)
+	{
+		print_arg_error("enable", "cannot open shared object", dlerror());
+		return (1);
+	}
+	desc = loadable_symbol(handle, name);
+	if (!desc)
+	{
+		dlclose(handle);
+		return (1);
+	}
+	return (loadable_add(&shell->loadables, desc, handle));
+}
+
+/**
+ * @brief Runs a loaded builtin in the current process on fds 0, 1 and 2,
+ * which the redirections have already set up
+ */
+int	loadable_run(const t_loadable *desc, char **argv, t_shell *shell)
+{
+	t_loadable_ctx	ctx;
+
+	ctx.abi_version = LOADABLE_ABI_VERSION;
+	ctx.in = STDIN_FILENO;
+	ctx.out = STDOUT_FILENO;
+	ctx.err = STDERR_FILENO;
+	ctx.shell = shell;
+	ctx.get_var = loadable_get_var;
+	ctx.set_var = loadable_set_var;
+	out_flush(&shell->out);
+	return (desc->run(argv, &ctx));
+}
@@ -0,0 +1,104 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   loadable_table.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/10/03 14:48:52 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/10/03 14:48:52 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+#include <dlfcn.h>
+
+/**
+ * @brief Finds the loaded builtin called name
+ * @details A handful of builtins are loaded at most, so the table is a
+ * plain array searched in order; it is only consulted once the compiled-in
+ * builtins have missed.
+ */
+const t_loadable	*loadable_find(const t_loadables *table, const char *name)
+{
+	size_t	i;
+
+	if (!name)
+		return (NULL);
+	i = 0;
+	while (i < table->count)
+	{
+		if (ft_strcmp((char *)table->items[i].desc->name, (char *)name) == 0)
+			return (table->items[i].desc);
+		i++;
+	}
+	return (NULL);
+}
+
+static int	loadable_grow(t_loadables *table)
+{
+	t_loaded	*items;
+	size_t		cap;
+
+	cap = 8;
+	if (table->cap)
+		cap = table->cap * 2;
+	items = malloc(sizeof(t_loaded) * cap);
+	if (!items)
+		return (1);
+	if (table->count)
+		ft_memcpy(items, table->items, sizeof(t_loaded) * table->count);
+	free(table->items);
+	table->items = items;
+	table->cap = cap;
+	return (0);
+}
+
+/**
+ * @brief Registers desc, loaded through handle; a builtin loaded again
+ * under the same name replaces the previous one
+ * @return 0 on success, 1 on allocation failure (handle is then closed)
+ */
+int	loadable_add(t_loadables *table, const t_loadable *desc, void *handle)
+{
+	loadable_remove(table, desc->name);
+	if (table->count == table->cap && loadable_grow(table))
+	{
+		dlclose(handle);
+		return (1);
+	}
+	table->items[table->count].desc = desc;
+	table->items[table->count].handle = handle;
+	table->count++;
+	return (0);
+}
+
+/**
+ * @brief Unloads the builtin called name
+ * @return 0 if it was loaded, 1 otherwise
+ */
+int	loadable_remove(t_loadables *table, const char *name)
+{
+	size_t	i;
+
+	i = 0;
+	while (i < table->count
+		&& ft_strcmp((char *)table->items[i].desc->name, (char *)name) != 0)
+		i++;
+	if (i == table->count)
+		return (1);
+	dlclose(table->items[i].handle);
+	table->count--;
+	ft_memmove(&table->items[i], &table->items[i + 1],
+		sizeof(t_loaded) * (table->count - i));
+	return (0);
+}
+
+void	loadable_clear(t_loadables *table)
+{
+	while (table->count)
+		dlclose(table->items[--table->count].handle);
+	free(table->items);
+	table->items = NULL;
+	table->cap = 0;
+}
@@ -0,0 +1,55 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   stats_stages.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/10/06 14:40:33 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/10/06 14:40:33 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+static void	print_stage(t_outbuf *out, size_t n, const t_stage *stage)
+{
+	t_times	times;
+
+	stage_times(stage, &times);
+	out_putnbr(out, n);
+	out_putc(out, '\t');
+	out_putnbr(out, stage->pid);
+	out_putc(out, '\t');
+	out_putnbr(out, stage->status);
+	out_putc(out, '\t');
+	out_putseconds(out, times.real, 3);
+	out_putc(out, '\t');
+	out_putseconds(out, times.user, 3);
+	out_putc(out, '\t');
+	out_putseconds(out, times.sys, 3);
+	out_putc(out, '\t');
+	out_putnbr(out, stage->maxrss);
+	out_putc(out, '\n');
+}
+
+/**
+ * @brief Prints the stages of the last pipeline as tab-separated columns
+ * under a header: position, pid (0 for a stage the shell ran), status,
+ * real, user and sys seconds, and peak RSS as getrusage reports it (KB on
+ * Linux)
+ */
+void	stats_print_stages(t_shell *shell)
+{
+	const t_stages	*stages;
+	size_t			i;
+
+	stages = &shell->last_stages;
+	out_puts(&shell->out, "stage\tpid\tstatus\treal\tuser\tsys\tmaxrss\n");
+	i = 0;
+	while (i < stages->count)
+	{
+		print_stage(&shell->out, i + 1, &stages->items[i]);
+		i++;
+	}
+}
@@ -0,0 +1,120 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_index.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/26 09:58:40 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/09/26 09:58:40 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "minishell.h"
+
+uint32_t	env_hash(const char *name, size_t len)
+{
+	uint32_t	hash;
+	size_t		i;
+
+	hash = 2166136261u;
+	i = 0;
+	while (i < len)
+	{
+		hash ^= (unsigned char)name[i++];
+		hash *= 16777619u;
+	}
+	return (hash);
+}
+
+/**
+ * @brief Finds the index slot holding name, or the empty slot ending its
+ * probe sequence
+ */
+size_t	env_probe(const t_env *env, const char *name, size_t len)
+{
+	t_env_var	*var;
+	size_t		mask;
+	size_t		pos;
+	uint32_t	hash;
+
+	hash = env_hash(name, len);
+	mask = env->index_cap - 1;
+	pos = hash & mask;
+	while (env->index[pos] != ENV_EMPTY)
+	{
+		if (env->index[pos] != ENV_GONE)
+		{
+			var = &env->vars[env->index[pos]];
+			if (var->hash == hash && var->name_len == len
+				&& !memcmp(var->entry, name, len))
+				return (pos);
+		}
+		pos = (pos + 1) & mask;
+	}
+	return (pos);
+}
+
+static void	env_reindex(t_env *env)
+{
+	size_t	mask;
+	size_t	pos;
+	size_t	i;
+
+	memset(env->index, 0xff, sizeof(int32_t) * env->index_cap);
+	mask = env->index_cap - 1;
+	i = 0;
+	while (i < env->n_vars)
+	{
+		pos = env->vars[i].hash & mask;
+		while (env->index[pos] != ENV_EMPTY)
+			pos = (pos + 1) & mask;
+		env->index[pos] = (int32_t)i++;
+	}
+}
+
+static void	env_install(t_env *env, t_env_var *vars, int32_t *index,
+		size_t cap)
+{
+	free(env->vars);
+	free(env->index);
+	env->vars = vars;
+	env->index = index;
+	env->index_cap = cap;
+}
+
+/**
+ * @brief Compacts vars and rebuilds the index for live variables
+ * @details The index is sized to at least 4 * live, so at least a quarter
+ * of its slots are inserted into before the next rebuild, whether they
+ * hold new names or replace unset ones.
+ * @return 0 on success, 1 on allocation failure (env unchanged)
+ */
+int	env_rebuild(t_env *env, size_t live)
+{
+	t_env_var	*vars;
+	int32_t		*index;
+	size_t		cap;
+	size_t		i;
+
+	cap = ENV_MIN_INDEX;
+	while (cap < live * 4)
+		cap *= 2;
+	vars = malloc(sizeof(t_env_var) * (cap / 2));
+	index = malloc(sizeof(int32_t) * cap);
+	if (!vars || !index)
+		return (free(vars), free(index), 1);
+	live = 0;
+	i = 0;
+	while (i < env->n_vars)
+	{
+		if (env->vars[i].entry)
+			vars[live++] = env->vars[i];
+		i++;
+	}
+	env_install(env, vars, index, cap);
+	env->n_vars = live;
+	env_reindex(env);
+	return (0);
+}
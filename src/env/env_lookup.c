@@ -0,0 +1,72 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_lookup.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/26 10:47:52 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/09/26 10:47:52 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "minishell.h"
+
+t_env_var	*env_find(const t_env *env, const char *name, size_t len)
+{
+	size_t	pos;
+
+	if (!env->index)
+		return (NULL);
+	pos = env_probe(env, name, len);
+	if (env->index[pos] == ENV_EMPTY)
+		return (NULL);
+	return (&env->vars[env->index[pos]]);
+}
+
+/**
+ * @brief Returns the value of name, owned by env, or NULL when unset
+ */
+const char	*env_get(const t_env *env, const char *name)
+{
+	t_env_var	*var;
+
+	var = env_find(env, name, strlen(name));
+	if (!var)
+		return (NULL);
+	return (var->entry + var->name_len + 1);
+}
+
+/**
+ * @brief Returns the environment as an execve array, rebuilding it only
+ * after a change
+ * @details The array borrows the entries; it stays valid until the next
+ * env_set or env_unset.
+ * @return NULL-terminated array owned by env, or NULL on allocation failure
+ */
+char	**env_envp(t_env *env)
+{
+	char	**envp;
+	size_t	i;
+	size_t	j;
+
+	if (env->envp && !env->dirty)
+		return (env->envp);
+	envp = malloc(sizeof(char *) * (env->count + 1));
+	if (!envp)
+		return (NULL);
+	i = 0;
+	j = 0;
+	while (i < env->n_vars)
+	{
+		if (env->vars[i].entry)
+			envp[j++] = env->vars[i].entry;
+		i++;
+	}
+	envp[j] = NULL;
+	free(env->envp);
+	env->envp = envp;
+	env->dirty = 0;
+	return (envp);
+}
@@ -0,0 +1,137 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_store.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/26 10:24:05 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/09/26 10:24:05 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "minishell.h"
+
+/**
+ * @brief Stores entry ("NAME=value", taken over) under its first
+ * name_len bytes, replacing any previous value in place
+ * @return 0 on success, 1 on allocation failure (entry is freed)
+ */
+static int	env_put(t_env *env, char *entry, size_t name_len)
+{
+	t_env_var	*var;
+	size_t		pos;
+
+	if ((!env->index || (env->n_vars + 1) * 2 > env->index_cap)
+		&& env_rebuild(env, env->count + 1))
+		return (free(entry), 1);
+	pos = env_probe(env, entry, name_len);
+	env->dirty = 1;
+	if (env->index[pos] != ENV_EMPTY)
+	{
+		var = &env->vars[env->index[pos]];
+		free(var->entry);
+		var->entry = entry;
+		return (0);
+	}
+	var = &env->vars[env->n_vars];
+	var->entry = entry;
+	var->name_len = name_len;
+	var->hash = env_hash(entry, name_len);
+	env->index[pos] = (int32_t)env->n_vars++;
+	env->count++;
+	return (0);
+}
+
+/**
+ * @brief Copies envp into env; entries without '=' are skipped
+ * @return 0 on success, 1 on allocation failure
+ */
+int	env_init(t_env *env, char **envp)
+{
+	char	*entry;
+	char	*eq;
+	size_t	n;
+	size_t	i;
+
+	ft_bzero(env, sizeof(t_env));
+	n = 0;
+	while (envp[n])
+		n++;
+	if (env_rebuild(env, n))
+		return (1);
+	i = 0;
+	while (i < n)
+	{
+		eq = ft_strchr(envp[i], '=');
+		if (eq)
+		{
+			entry = ft_strdup(envp[i]);
+			if (!entry || env_put(env, entry, eq - envp[i]))
+				return (env_destroy(env), 1);
+		}
+		i++;
+	}
+	return (0);
+}
+
+/**
+ * @brief Sets name to value (NULL stores an empty value)
+ * @return 0 on success, 1 on allocation failure
+ */
+int	env_set(t_env *env, const char *name, const char *value)
+{
+	char	*entry;
+	size_t	name_len;
+	size_t	value_len;
+
+	name_len = strlen(name);
+	value_len = 0;
+	if (value)
+		value_len = strlen(value);
+	entry = malloc(name_len + value_len + 2);
+	if (!entry)
+		return (1);
+	memcpy(entry, name, name_len);
+	entry[name_len] = '=';
+	if (value)
+		memcpy(entry + name_len + 1, value, value_len);
+	entry[name_len + value_len + 1] = '\0';
+	return (env_put(env, entry, name_len));
+}
+
+/**
+ * @brief Removes name; its slot in vars is reclaimed by the next rebuild
+ */
+int	env_unset(t_env *env, const char *name)
+{
+	t_env_var	*var;
+	size_t		pos;
+
+	if (!env->index)
+		return (0);
+	pos = env_probe(env, name, strlen(name));
+	if (env->index[pos] == ENV_EMPTY)
+		return (0);
+	var = &env->vars[env->index[pos]];
+	free(var->entry);
+	var->entry = NULL;
+	env->index[pos] = ENV_GONE;
+	env->count--;
+	env->dirty = 1;
+	return (0);
+}
+
+void	env_destroy(t_env *env)
+{
+	size_t	i;
+
+	i = 0;
+	while (i < env->n_vars)
+		free(env->vars[i++].entry);
+	free(env->vars);
+	free(env->index);
+	free(env->envp);
+	ft_bzero(env, sizeof(t_env));
+}
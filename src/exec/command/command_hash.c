@@ -0,0 +1,107 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   command_hash.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/28 10:31:07 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/09/28 10:31:07 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "minishell.h"
+
+/**
+ * @brief Doubles the bucket array (or creates it) and rehashes the chains
+ * @details Entries are taken off the head of each old chain until it is
+ * empty.
+ */
+static int	cmd_hash_grow(t_cmd_hash *table)
+{
+	t_hashed_cmd	**buckets;
+	t_hashed_cmd	*entry;
+	size_t			n;
+	size_t			i;
+
+	n = CMD_HASH_MIN_BUCKETS;
+	if (table->n_buckets)
+		n = table->n_buckets * 2;
+	buckets = ft_calloc(n, sizeof(t_hashed_cmd *));
+	if (!buckets)
+		return (1);
+	i = 0;
+	while (i < table->n_buckets)
+	{
+		entry = table->buckets[i];
+		if (!entry && ++i)
+			continue ;
+		table->buckets[i] = entry->next;
+		entry->next = buckets[entry->hash & (n - 1)];
+		buckets[entry->hash & (n - 1)] = entry;
+	}
+	free(table->buckets);
+	table->buckets = buckets;
+	table->n_buckets = n;
+	return (0);
+}
+
+t_hashed_cmd	*cmd_hash_find(t_cmd_hash *table, const char *name)
+{
+	t_hashed_cmd	*entry;
+	uint32_t		hash;
+
+	if (!table->count)
+		return (NULL);
+	hash = env_hash(name, strlen(name));
+	entry = table->buckets[hash & (table->n_buckets - 1)];
+	while (entry && (entry->hash != hash || strcmp(entry->name, name)))
+		entry = entry->next;
+	return (entry);
+}
+
+static t_hashed_cmd	*cmd_hash_link(t_cmd_hash *table, const char *name)
+{
+	t_hashed_cmd	*entry;
+	size_t			slot;
+
+	if (table->count >= table->n_buckets && cmd_hash_grow(table))
+		return (NULL);
+	entry = malloc(sizeof(t_hashed_cmd));
+	if (!entry)
+		return (NULL);
+	entry->name = ft_strdup(name);
+	if (!entry->name)
+		return (free(entry), NULL);
+	entry->path = NULL;
+	entry->hash = env_hash(name, strlen(name));
+	slot = entry->hash & (table->n_buckets - 1);
+	entry->next = table->buckets[slot];
+	table->buckets[slot] = entry;
+	table->count++;
+	return (entry);
+}
+
+/**
+ * @brief Records that name resolves to path, replacing any older entry
+ * @details The table takes ownership of path, which must be malloc'd; it
+ * is freed here if the entry cannot be created. Hits start at zero.
+ */
+t_hashed_cmd	*cmd_hash_add(t_cmd_hash *table, const char *name, char *path)
+{
+	t_hashed_cmd	*entry;
+
+	entry = cmd_hash_find(table, name);
+	if (!entry)
+		entry = cmd_hash_link(table, name);
+	if (!entry)
+	{
+		free(path);
+		return (NULL);
+	}
+	free(entry->path);
+	entry->path = path;
+	entry->hits = 0;
+	return (entry);
+}
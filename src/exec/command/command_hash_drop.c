@@ -0,0 +1,82 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   command_hash_drop.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/10/08 15:02:44 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/10/08 15:02:44 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+static void	cmd_hash_free(t_hashed_cmd *entry)
+{
+	free(entry->name);
+	free(entry->path);
+	free(entry);
+}
+
+/**
+ * @brief Forgets the entry for name, if any
+ */
+void	cmd_hash_remove(t_cmd_hash *table, const char *name)
+{
+	t_hashed_cmd	**link;
+	t_hashed_cmd	*entry;
+
+	entry = cmd_hash_find(table, name);
+	if (!entry)
+		return ;
+	link = &table->buckets[entry->hash & (table->n_buckets - 1)];
+	while (*link != entry)
+		link = &(*link)->next;
+	*link = entry->next;
+	cmd_hash_free(entry);
+	table->count--;
+}
+
+/**
+ * @brief Finds name for running it: an entry whose path is no longer
+ * executable is forgotten, so that PATH is searched again as bash does
+ */
+t_hashed_cmd	*cmd_hash_check(t_cmd_hash *table, const char *name)
+{
+	t_hashed_cmd	*entry;
+
+	entry = cmd_hash_find(table, name);
+	if (entry && access(entry->path, X_OK) == -1)
+	{
+		cmd_hash_remove(table, name);
+		return (NULL);
+	}
+	return (entry);
+}
+
+/**
+ * @brief Forgets every hashed command (hash -r, or PATH changed)
+ */
+void	cmd_hash_clear(t_cmd_hash *table)
+{
+	t_hashed_cmd	*entry;
+	t_hashed_cmd	*next;
+	size_t			i;
+
+	i = 0;
+	while (i < table->n_buckets)
+	{
+		entry = table->buckets[i++];
+		while (entry)
+		{
+			next = entry->next;
+			cmd_hash_free(entry);
+			entry = next;
+		}
+	}
+	free(table->buckets);
+	table->buckets = NULL;
+	table->n_buckets = 0;
+	table->count = 0;
+}
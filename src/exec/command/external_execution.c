@@ -12,35 +12,104 @@
 
 #include "minishell.h"
 
+/**
+ * @brief Searches PATH for command
+ * @return Newly allocated path of the program, or NULL if not found
+ */
 char	*find_command_path(const char *command, t_shell *shell)
 {
-	char	*path;
-	char	**path_dirs;
-	char	*result;
+	const char	*path;
+	char		*result;
 
 	if (!command || !shell)
 		return (NULL);
 	result = check_absolute_path(command);
 	if (result)
 		return (result);
-	path = get_env_var("PATH", shell);
-	if (!path)
+	path = env_get(&shell->env, "PATH");
+	if (!path || !*command)
 		return (NULL);
-	path_dirs = ft_split(path, ':');
-	free(path);
-	if (!path_dirs)
-		return (NULL);
-	return (search_path_dirs(command, path_dirs));
+	return (search_path_dirs(command, path));
 }
 
-int	execute_external_in_child(t_cmd *cmd, t_shell *shell)
+/**
+ * @brief Path command runs from, searched in PATH on first use only
+ * @details A name with a slash is used as is. Others go through the
+ * command hash, whose entries count their hits as bash's do; PATH is
+ * searched again when the hashed file is gone.
+ * @return The path in the per-line arena, or NULL if not found
+ */
+static char	*resolve_command(const char *command, t_shell *shell)
+{
+	t_hashed_cmd	*entry;
+	char			*path;
+
+	if (ft_strchr(command, '/'))
+	{
+		if (access(command, X_OK) == -1)
+			return (NULL);
+		return ((char *)command);
+	}
+	entry = cmd_hash_check(&shell->commands, command);
+	if (!entry)
+	{
+		path = find_command_path(command, shell);
+		if (!path)
+			return (NULL);
+		entry = cmd_hash_add(&shell->commands, command, path);
+		if (!entry)
+			return (NULL);
+	}
+	entry->hits++;
+	return (arena_strdup(&shell->arena, entry->path));
+}
+
+/**
+ * @brief Resolves what one expanded command runs: a compiled-in builtin,
+ * then a loaded one, then a program found through the command hash
+ */
+static void	resolve_command_target(t_cmd *cmd, t_shell *shell)
 {
-	char	*command_path;
+	cmd->builtin = BUILTIN_NONE;
+	cmd->loadable = NULL;
+	cmd->path = NULL;
+	if (!cmd->argv || !cmd->argv[0])
+		return ;
+	cmd->builtin = builtin_lookup(cmd->argv[0]);
+	if (!cmd->builtin)
+		cmd->loadable = loadable_find(&shell->loadables, cmd->argv[0]);
+	if (cmd->loadable)
+		cmd->builtin = BUILTIN_LOADABLE;
+	if (!cmd->builtin)
+		cmd->path = resolve_command(cmd->argv[0], shell);
+}
 
+/**
+ * @brief Resolves what every command of a pipeline runs
+ * @details Runs in the parent, once per command after expansion and before
+ * any fork, so that the command hash fills up, no child has to search PATH
+ * and the executor branches on cmd->builtin rather than on names.
+ */
+void	resolve_command_paths(t_cmd *cmd_list, t_shell *shell)
+{
+	while (cmd_list)
+	{
+		resolve_command_target(cmd_list, shell);
+		cmd_list = cmd_list->next;
+	}
+}
+
+/**
+ * @brief Execs cmd in a forked child, or in place of the shell for the
+ * last command of -c; the trace is ended first, as the process that
+ * writes it is replaced
+ * @return The exit status when cmd cannot be run
+ */
+int	execute_external_in_child(t_cmd *cmd, t_shell *shell)
+{
 	if (!cmd || !cmd->argv || !cmd->argv[0] || !shell)
 		return (1);
-	command_path = find_command_path(cmd->argv[0], shell);
-	if (!command_path)
+	if (!cmd->path)
 	{
 		if (ft_strchr(cmd->argv[0], '/') && access(cmd->argv[0], F_OK) == -1)
 			print_command_error(cmd->argv[0], "No such file or directory");
@@ -50,8 +119,9 @@ int	execute_external_in_child(t_cmd *cmd, t_shell *shell)
 	}
 	signal(SIGINT, SIG_DFL);
 	signal(SIGQUIT, SIG_DFL);
-	execve(command_path, cmd->argv, shell->envp);
+	trace_execve(&shell->trace, getpid(), cmd->path);
+	trace_close(&shell->trace);
+	execve(cmd->path, cmd->argv, env_envp(&shell->env));
 	print_error("execve", strerror(errno));
-	free(command_path);
 	return (CMD_PERMISSION_DENIED);
 }
@@ -25,43 +25,66 @@ char	*check_absolute_path(const char *command)
 	return (NULL);
 }
 
-static char	*build_command_path(const char *command, const char *dir)
+/**
+ * @brief Tries each directory of a colon-separated PATH in turn
+ * @details Candidates are built in a stack buffer, so only the match is
+ * allocated. Empty entries are skipped.
+ * @return Newly allocated path of the first executable match, or NULL
+ */
+char	*search_path_dirs(const char *command, const char *path)
 {
-	char	*full_path;
-	int		len;
+	char		full_path[PATH_MAX];
+	const char	*end;
+	size_t		dir_len;
+	size_t		cmd_len;
 
-	len = ft_strlen(dir) + ft_strlen(command) + 2;
-	full_path = malloc(len);
-	if (!full_path)
-		return (NULL);
-	ft_strlcpy(full_path, dir, ft_strlen(dir) + 1);
-	ft_strlcat(full_path, "/", ft_strlen(dir) + 2);
-	ft_strlcat(full_path, command, len);
-	return (full_path);
-}
-
-char	*search_path_dirs(const char *command, char **path_dirs)
-{
-	char	*full_path;
-	int		i;
-
-	i = 0;
-	while (path_dirs[i])
+	cmd_len = strlen(command);
+	while (path)
 	{
-		full_path = build_command_path(command, path_dirs[i]);
-		if (!full_path)
-		{
-			ft_strarr_free(path_dirs);
-			return (NULL);
-		}
-		if (access(full_path, X_OK) == 0)
+		end = strchr(path, ':');
+		if (!end)
+			end = path + strlen(path);
+		dir_len = end - path;
+		if (dir_len && dir_len + cmd_len + 2 <= sizeof(full_path))
 		{
-			ft_strarr_free(path_dirs);
-			return (full_path);
+			memcpy(full_path, path, dir_len);
+			full_path[dir_len] = '/';
+			memcpy(full_path + dir_len + 1, command, cmd_len + 1);
+			if (access(full_path, X_OK) == 0)
+				return (ft_strdup(full_path));
 		}
-		free(full_path);
-		i++;
+		path = NULL;
+		if (*end)
+			path = end + 1;
 	}
-	ft_strarr_free(path_dirs);
 	return (NULL);
 }
+
+/**
+ * @brief fork() for cmd, which may exec, with the environment array
+ * built first so that the parent keeps it for the next command, and
+ * builtin output flushed so the child does not inherit it
+ * @details The shell traces the fork; the child opens its own track, so
+ * that its events come after the start of the track.
+ */
+pid_t	fork_command(t_cmd *cmd, t_shell *shell)
+{
+	const char	*name;
+	pid_t		pid;
+
+	out_flush(&shell->out);
+	env_envp(&shell->env);
+	name = NULL;
+	if (cmd->argv)
+		name = cmd->argv[0];
+	trace_event(&shell->trace, "fork", TRACE_BEGIN);
+	pid = fork();
+	if (pid == 0)
+		trace_child_start(&shell->trace, getpid(), name);
+	if (pid == 0)
+		return (0);
+	trace_event(&shell->trace, "fork", TRACE_END);
+	if (pid > 0)
+		shell->forks++;
+	return (pid);
+}
@@ -0,0 +1,145 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   redir_plan.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/10/01 10:52:19 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/10/01 10:52:19 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "minishell.h"
+
+/**
+ * @brief Reads the word of "N>&word" or "N<&word"
+ * @return The fd it names, REDIR_DUP_CLOSE for "-" or REDIR_DUP_FILE for
+ * anything else; numbers above REDIR_FD_MAX saturate
+ */
+int	redir_dup_word(const char *word)
+{
+	int	fd;
+
+	if (word[0] == '-' && !word[1])
+		return (REDIR_DUP_CLOSE);
+	if (!*word)
+		return (REDIR_DUP_FILE);
+	fd = 0;
+	while (ft_isdigit(*word))
+	{
+		if (fd <= REDIR_FD_MAX)
+			fd = fd * 10 + *word - '0';
+		word++;
+	}
+	if (*word)
+		return (REDIR_DUP_FILE);
+	return (fd);
+}
+
+/**
+ * @brief Opens the file of a redirection, close-on-exec so that only its
+ * target reaches a program; a heredoc passes its body fd to the plan
+ * @return The fd, or -1 with errno set
+ */
+static int	open_redir(t_redir *r)
+{
+	int	fd;
+	int	flags;
+
+	if (r->type == REDIR_HEREDOC)
+	{
+		fd = r->fd;
+		r->fd = -1;
+		if (fd < 0)
+			errno = EBADF;
+		return (fd);
+	}
+	flags = O_WRONLY | O_CREAT | O_TRUNC;
+	if (r->type == REDIR_IN)
+		flags = O_RDONLY;
+	else if (r->type == REDIR_APPEND)
+		flags = O_WRONLY | O_CREAT | O_APPEND;
+	return (open(r->file, flags | O_CLOEXEC, 0644));
+}
+
+/**
+ * @brief "N>&M", "N<&M" and "N>&-"
+ * @details M is whatever fd M is at this point of the command: a target
+ * set earlier, or the shell's own fd M if it is open and not one the plan
+ * opened.
+ */
+static int	plan_dup(t_redir_plan *plan, t_redir *r)
+{
+	int	source;
+
+	source = redir_dup_word(r->file);
+	if (source == REDIR_DUP_CLOSE)
+	{
+		redir_plan_set(plan, r->io_fd, -1);
+		return (0);
+	}
+	if (source == REDIR_DUP_FILE)
+		return (redir_plan_fail(plan, r->file, "ambiguous redirect"));
+	if (source <= REDIR_FD_MAX && plan->changed & (1 << source))
+		source = plan->source[source];
+	else if (source > REDIR_FD_MAX || redir_plan_owns(plan, source)
+		|| fcntl(source, F_GETFD) == -1)
+		source = -1;
+	if (source == -1)
+		return (redir_plan_fail(plan, r->file, strerror(EBADF)));
+	redir_plan_set(plan, r->io_fd, source);
+	return (0);
+}
+
+/**
+ * @brief Adds one redirection to the table
+ * @details ">&word" with a word that is not a number is "&>word", as in
+ * bash.
+ */
+static int	plan_redir(t_redir_plan *plan, t_redir *r)
+{
+	int	fd;
+	int	both;
+
+	if (r->io_fd > REDIR_FD_MAX)
+	{
+		plan->error_fd = r->io_fd;
+		return (redir_plan_fail(plan, NULL, strerror(EBADF)));
+	}
+	if (r->type == REDIR_DUP_IN || (r->type == REDIR_DUP_OUT
+			&& (r->io_fd != STDOUT_FILENO
+				|| redir_dup_word(r->file) != REDIR_DUP_FILE)))
+		return (plan_dup(plan, r));
+	both = r->type == REDIR_OUT_ALL || r->type == REDIR_DUP_OUT;
+	fd = open_redir(r);
+	if (fd == -1)
+		return (redir_plan_fail(plan, r->file, strerror(errno)));
+	if (redir_plan_track(plan, fd))
+		return (redir_plan_fail(plan, r->file, strerror(EMFILE)));
+	redir_plan_set(plan, r->io_fd, fd);
+	if (both)
+		redir_plan_set(plan, STDERR_FILENO, fd);
+	return (0);
+}
+
+/**
+ * @brief Adds the redirections of a command to the fd table of plan
+ * @details Files are opened in order, so "> a > b" still creates a, but
+ * a target that is redirected again only keeps its last source: a is
+ * closed as soon as b replaces it and never reaches a dup2.
+ * @return 0, or 1 after reporting the first redirection that failed
+ */
+int	redir_plan_add(t_redir_plan *plan, t_redir *redirs)
+{
+	while (redirs)
+	{
+		if (plan_redir(plan, redirs))
+		{
+			redir_plan_report(plan);
+			redir_plan_discard(plan);
+			return (1);
+		}
+		redirs = redirs->next;
+	}
+	return (0);
+}
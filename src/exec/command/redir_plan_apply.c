@@ -0,0 +1,118 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   redir_plan_apply.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/10/01 11:37:02 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/10/01 11:37:02 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "minishell.h"
+
+/**
+ * @brief Moves every source that is also a redirected fd, so the table
+ * can be applied in any order with one dup2 per target
+ * @details This only happens for fd swaps such as "3>&1 1>&2 2>&3" or
+ * when a file opened onto a low fd the command also redirects.
+ */
+static int	plan_resolve(t_redir_plan *plan)
+{
+	int	target;
+
+	target = 0;
+	while (target <= REDIR_FD_MAX)
+	{
+		if (plan->changed & (1 << target) && redir_plan_uses(plan, target)
+			&& redir_plan_relocate(plan, target))
+			return (-1);
+		target++;
+	}
+	return (0);
+}
+
+/**
+ * @brief Installs the table: one dup2 or close per redirected fd, then
+ * the plan's own fds are closed
+ * @return 0, or 1 after reporting the failure
+ */
+int	redir_plan_apply(t_redir_plan *plan)
+{
+	int	target;
+	int	error;
+
+	error = plan_resolve(plan);
+	target = 0;
+	while (!error && target <= REDIR_FD_MAX)
+	{
+		if (plan->changed & (1 << target) && plan->source[target] == -1)
+			close(target);
+		else if (plan->changed & (1 << target))
+			error = dup2(plan->source[target], target) == -1;
+		target++;
+	}
+	if (error)
+		print_error("redirection", strerror(errno));
+	redir_plan_discard(plan);
+	return (error != 0);
+}
+
+static int	save_failed(t_redir_plan *plan, int last)
+{
+	print_error("redirection", strerror(errno));
+	while (last-- > 0)
+	{
+		if (plan->changed & (1 << last) && plan->saved[last] != -1)
+			close(plan->saved[last]);
+	}
+	redir_plan_discard(plan);
+	return (1);
+}
+
+/**
+ * @brief Keeps a copy of each fd the plan redirects, and only those, for
+ * redir_plan_restore
+ * @details A target the plan itself opened a file onto was closed before.
+ * @return 0, or 1 after reporting the failure and discarding the plan
+ */
+int	redir_plan_save(t_redir_plan *plan)
+{
+	int	target;
+
+	target = 0;
+	while (target <= REDIR_FD_MAX)
+	{
+		plan->saved[target] = -1;
+		if (plan->changed & (1 << target) && !redir_plan_owns(plan, target))
+		{
+			plan->saved[target] = fcntl(target, F_DUPFD_CLOEXEC,
+					REDIR_FD_BASE);
+			if (plan->saved[target] == -1 && errno != EBADF)
+				return (save_failed(plan, target));
+		}
+		target++;
+	}
+	return (0);
+}
+
+/**
+ * @brief Puts back the fds saved by redir_plan_save
+ */
+void	redir_plan_restore(t_redir_plan *plan)
+{
+	int	target;
+
+	target = 0;
+	while (target <= REDIR_FD_MAX)
+	{
+		if (plan->changed & (1 << target) && plan->saved[target] != -1)
+		{
+			dup2(plan->saved[target], target);
+			close(plan->saved[target]);
+		}
+		else if (plan->changed & (1 << target))
+			close(target);
+		target++;
+	}
+}
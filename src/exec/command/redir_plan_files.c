@@ -0,0 +1,86 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   redir_plan_files.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/10/01 11:08:37 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/10/01 11:08:37 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "minishell.h"
+
+/**
+ * @brief Whether fd is one the plan opened or copied for itself
+ */
+int	redir_plan_owns(t_redir_plan *plan, int fd)
+{
+	int	i;
+
+	i = 0;
+	while (i < plan->n_files)
+	{
+		if (plan->files[i] == fd)
+			return (1);
+		i++;
+	}
+	return (0);
+}
+
+/**
+ * @brief Takes ownership of fd; it is closed if the table is full
+ */
+int	redir_plan_track(t_redir_plan *plan, int fd)
+{
+	if (plan->n_files == REDIR_PLAN_FILES)
+	{
+		close(fd);
+		return (1);
+	}
+	plan->files[plan->n_files++] = fd;
+	return (0);
+}
+
+/**
+ * @brief Closes an owned fd that no target reads any more
+ */
+void	redir_plan_release(t_redir_plan *plan, int fd)
+{
+	int	i;
+
+	i = 0;
+	while (i < plan->n_files && plan->files[i] != fd)
+		i++;
+	if (i == plan->n_files)
+		return ;
+	close(fd);
+	plan->files[i] = plan->files[--plan->n_files];
+}
+
+/**
+ * @brief Records that old moved to fd: an owned old is closed and fd
+ * takes its place, a copy of one of the shell's fds becomes owned
+ */
+int	redir_plan_replace(t_redir_plan *plan, int old, int fd)
+{
+	int	i;
+
+	i = 0;
+	while (i < plan->n_files && plan->files[i] != old)
+		i++;
+	if (i == plan->n_files)
+		return (redir_plan_track(plan, fd));
+	close(old);
+	plan->files[i] = fd;
+	return (0);
+}
+
+/**
+ * @brief Closes every fd the plan owns
+ */
+void	redir_plan_discard(t_redir_plan *plan)
+{
+	while (plan->n_files)
+		close(plan->files[--plan->n_files]);
+}
@@ -0,0 +1,54 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   redir_plan_init.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/10/05 09:12:41 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/10/05 09:12:41 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Starts an empty plan: no fd redirected, none owned
+ */
+void	redir_plan_init(t_redir_plan *plan)
+{
+	plan->changed = 0;
+	plan->n_files = 0;
+	plan->error_fd = -1;
+}
+
+/**
+ * @brief Starts a plan on the pipe ends of a pipeline stage, -1 for none
+ * @details The plan owns them from here on: they are closed once it is
+ * applied or discarded, and the command's own redirections override them
+ * as they override the pipe in a child.
+ */
+void	redir_plan_pipe(t_redir_plan *plan, int in, int out)
+{
+	redir_plan_init(plan);
+	if (in != -1)
+	{
+		redir_plan_track(plan, in);
+		redir_plan_set(plan, STDIN_FILENO, in);
+	}
+	if (out != -1)
+	{
+		redir_plan_track(plan, out);
+		redir_plan_set(plan, STDOUT_FILENO, out);
+	}
+}
+
+/**
+ * @brief Resolves the redirections of a command into its final fd table
+ * @return 0, or 1 after reporting the first redirection that failed
+ */
+int	redir_plan_build(t_redir_plan *plan, t_redir *redirs)
+{
+	redir_plan_init(plan);
+	return (redir_plan_add(plan, redirs));
+}
@@ -0,0 +1,115 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   redir_plan_table.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/10/01 11:21:50 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/10/01 11:21:50 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "minishell.h"
+
+/**
+ * @brief Whether any redirected fd takes fd as its source
+ */
+int	redir_plan_uses(t_redir_plan *plan, int fd)
+{
+	int	target;
+
+	target = 0;
+	while (target <= REDIR_FD_MAX)
+	{
+		if (plan->changed & (1 << target) && plan->source[target] == fd)
+			return (1);
+		target++;
+	}
+	return (0);
+}
+
+/**
+ * @brief Makes source the fd that ends up as target
+ * @details The previous source is closed at once if the plan opened it
+ * and nothing else reads it, so "> a > b > c" never holds more than one
+ * of the three files.
+ */
+void	redir_plan_set(t_redir_plan *plan, int target, int source)
+{
+	int	old;
+
+	old = -1;
+	if (plan->changed & (1 << target))
+		old = plan->source[target];
+	plan->source[target] = source;
+	plan->changed |= 1 << target;
+	if (old != -1 && old != source && !redir_plan_uses(plan, old))
+		redir_plan_release(plan, old);
+}
+
+/**
+ * @brief Moves a source out of the way of a target that replaces it
+ * @details The copy is close-on-exec and at REDIR_FD_BASE or above, so
+ * no target can land on it; every target reading fd reads the copy.
+ * @return 0, or -1 if fd could not be copied
+ */
+int	redir_plan_relocate(t_redir_plan *plan, int fd)
+{
+	int	moved;
+	int	target;
+
+	moved = fcntl(fd, F_DUPFD_CLOEXEC, REDIR_FD_BASE);
+	if (moved == -1)
+		return (-1);
+	target = 0;
+	while (target <= REDIR_FD_MAX)
+	{
+		if (plan->changed & (1 << target) && plan->source[target] == fd)
+			plan->source[target] = moved;
+		target++;
+	}
+	if (redir_plan_replace(plan, fd, moved))
+		return (-1);
+	return (0);
+}
+
+int	redir_plan_fail(t_redir_plan *plan, const char *word, const char *error)
+{
+	plan->error_word = word;
+	plan->error = error;
+	return (1);
+}
+
+/**
+ * @brief Prints the error of a failed plan where bash would: on stderr as
+ * the redirections before the failing one left it
+ * @details "2>&1 >&9" reports on stdout, "2>&- >&9" reports nothing.
+ */
+void	redir_plan_report(t_redir_plan *plan)
+{
+	char	*number;
+	int		saved;
+
+	if (plan->changed & (1 << STDERR_FILENO)
+		&& plan->source[STDERR_FILENO] == -1)
+		return ;
+	number = NULL;
+	if (plan->error_fd >= 0)
+		number = ft_itoa(plan->error_fd);
+	if (number)
+		plan->error_word = number;
+	saved = -2;
+	if (plan->changed & (1 << STDERR_FILENO))
+	{
+		saved = fcntl(STDERR_FILENO, F_DUPFD_CLOEXEC, REDIR_FD_BASE);
+		dup2(plan->source[STDERR_FILENO], STDERR_FILENO);
+	}
+	print_error(plan->error_word, plan->error);
+	if (saved >= 0)
+		dup2(saved, STDERR_FILENO);
+	if (saved >= 0)
+		close(saved);
+	else if (saved == -1)
+		close(STDERR_FILENO);
+	free(number);
+}
@@ -12,33 +12,10 @@
 
 #include "minishell.h"
 
-static int	process_redirection(t_redir *redir)
-{
-	if (redir->type == REDIR_IN)
-		return (handle_input_redirection(redir->file));
-	else if (redir->type == REDIR_OUT)
-		return (handle_output_redirection(redir->file));
-	else if (redir->type == REDIR_APPEND)
-		return (handle_append_redirection(redir->file));
-	else if (redir->type == REDIR_HEREDOC)
-	{
-		if (redir->fd < 0)
-			return (1);
-		if (dup2(redir->fd, STDIN_FILENO) == -1)
-			return (perror("dup2 heredoc"), 1);
-		close(redir->fd);
-		redir->fd = -1;
-		return (0);
-	}
-	return (0);
-}
-
-int	process_heredocs(t_redir *redirs, t_shell *shell)
+static int	build_heredocs(t_redir *redirs, t_shell *shell)
 {
 	t_redir	*current;
 
-	if (!redirs)
-		return (0);
 	current = redirs;
 	while (current)
 	{
@@ -56,30 +33,38 @@ int	process_heredocs(t_redir *redirs, t_shell *shell)
 	return (0);
 }
 
-int	setup_redirections(t_redir *redirs)
+/**
+ * @brief Builds the heredoc bodies of a command before it runs, as a
+ * "process_heredocs" trace phase when it has any
+ * @return 0, EXIT_STATUS_SIGINT when interrupted, 1 on failure
+ */
+int	process_heredocs(t_redir *redirs, t_shell *shell)
 {
 	t_redir	*current;
+	int		status;
 
-	if (!redirs)
-		return (0);
 	current = redirs;
-	while (current)
-	{
-		if (current->type == REDIR_HEREDOC)
-		{
-			if (current->fd < 0)
-				return (perror("heredoc fd invalid"), 1);
-			if (dup2(current->fd, STDIN_FILENO) == -1)
-				return (perror("dup2 heredoc"), 1);
-			close(current->fd);
-			current->fd = -1;
-		}
-		else
-		{
-			if (process_redirection(current))
-				return (1);
-		}
+	while (current && current->type != REDIR_HEREDOC)
 		current = current->next;
-	}
-	return (0);
+	if (!current)
+		return (0);
+	trace_event(&shell->trace, "process_heredocs", TRACE_BEGIN);
+	status = build_heredocs(current, shell);
+	trace_event(&shell->trace, "process_heredocs", TRACE_END);
+	return (status);
+}
+
+/**
+ * @brief Performs the redirections of a command in a child, where nothing
+ * has to be restored
+ */
+int	setup_redirections(t_redir *redirs)
+{
+	t_redir_plan	plan;
+
+	if (!redirs)
+		return (0);
+	if (redir_plan_build(&plan, redirs))
+		return (1);
+	return (redir_plan_apply(&plan));
 }
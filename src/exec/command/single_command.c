@@ -12,53 +12,48 @@
 
 #include "minishell.h"
 
-int	execute_parent_builtin(t_cmd *cmd, t_shell *shell)
-{
-	if (ft_strcmp(cmd->argv[0], "exit") == 0)
-		return (builtin_exit(cmd->argv, shell));
-	if (ft_strcmp(cmd->argv[0], "cd") == 0)
-		return (builtin_cd(cmd->argv, shell));
-	if (ft_strcmp(cmd->argv[0], "export") == 0)
-		return (builtin_export(cmd->argv, shell));
-	if (ft_strcmp(cmd->argv[0], "unset") == 0)
-		return (builtin_unset(cmd->argv, shell));
-	return (0);
-}
-
-static void	restore_std_fds(int stdin_fd, int stdout_fd, int stderr_fd)
-{
-	dup2(stdin_fd, STDIN_FILENO);
-	dup2(stdout_fd, STDOUT_FILENO);
-	dup2(stderr_fd, STDERR_FILENO);
-	close(stdin_fd);
-	close(stdout_fd);
-	close(stderr_fd);
-}
-
+/**
+ * @brief Runs a builtin in the shell itself with its redirections
+ * @details Only the fds the redirections change are saved and restored;
+ * a builtin without redirections costs no system call here. A pipeline
+ * stage starts from its pipe ends, which the plan closes.
+ */
 int	execute_builtin_with_redirections(t_cmd *cmd, t_shell *shell)
 {
-	int	stdin_backup;
-	int	stdout_backup;
-	int	stderr_backup;
-	int	result;
+	t_redir_plan	plan;
+	int				result;
 
-	stdin_backup = dup(STDIN_FILENO);
-	stdout_backup = dup(STDOUT_FILENO);
-	stderr_backup = dup(STDERR_FILENO);
-	if (setup_redirections(cmd->redirs))
+	redir_plan_init(&plan);
+	if (cmd->in_shell)
+		redir_plan_pipe(&plan, cmd->stage_in, cmd->stage_out);
+	cmd->stage_in = -1;
+	cmd->stage_out = -1;
+	if (redir_plan_add(&plan, cmd->redirs) || redir_plan_save(&plan))
+		return (1);
+	if (redir_plan_apply(&plan))
 	{
-		restore_std_fds(stdin_backup, stdout_backup, stderr_backup);
+		redir_plan_restore(&plan);
 		return (1);
 	}
-	result = execute_parent_builtin(cmd, shell);
-	restore_std_fds(stdin_backup, stdout_backup, stderr_backup);
+	result = builtin_flush(shell, cmd->argv[0], builtin_run(cmd, shell));
+	redir_plan_restore(&plan);
 	return (result);
 }
 
-int	check_parent_builtin(char *cmd_name)
+/**
+ * @brief Runs a builtin that is a pipeline of its own in the shell and
+ * records it as the only stage
+ */
+int	execute_builtin_alone(t_cmd *cmd, t_shell *shell)
 {
-	return (ft_strcmp(cmd_name, "exit") == 0
-		|| ft_strcmp(cmd_name, "cd") == 0
-		|| ft_strcmp(cmd_name, "export") == 0
-		|| ft_strcmp(cmd_name, "unset") == 0);
+	struct rusage	before;
+	t_stage			*stage;
+	int				status;
+
+	stage = stages_add(&shell->stages);
+	getrusage(RUSAGE_SELF, &before);
+	status = execute_builtin_with_redirections(cmd, shell);
+	cleanup_heredoc_fds(cmd);
+	stage_end_self(stage, status, &before);
+	return (status);
 }
@@ -22,7 +22,7 @@ static int	handle_child_process(t_cmd *cmd, t_shell *shell)
 		shell_cleanup(shell);
 		exit(1);
 	}
-	if (is_builtin(cmd->argv[0]))
+	if (cmd->builtin)
 		exit_code = execute_builtin_in_child(cmd, shell);
 	else
 		exit_code = execute_external_in_child(cmd, shell);
@@ -41,29 +41,64 @@ static int	get_child_exit_status(int status)
 	return (WEXITSTATUS(status));
 }
 
-static int	handle_parent_process(t_cmd *cmd, pid_t pid)
+static int	handle_parent_process(t_cmd *cmd, pid_t pid, t_shell *shell)
 {
-	int	status;
+	struct rusage	usage;
+	int				status;
 
 	status = 0;
 	if (pid > 0)
 	{
-		waitpid(pid, &status, 0);
+		trace_event(&shell->trace, "wait4", TRACE_BEGIN);
+		while (wait4(pid, &status, 0, &usage) == -1 && errno == EINTR)
+			;
+		trace_event(&shell->trace, "wait4", TRACE_END);
 		cleanup_heredoc_fds(cmd);
-		return (get_child_exit_status(status));
+		status = get_child_exit_status(status);
+		stages_reap(&shell->stages, pid, status, &usage);
+		trace_child_end(&shell->trace, pid, status);
+		return (status);
 	}
 	cleanup_heredoc_fds(cmd);
 	print_error("fork", strerror(errno));
 	return (1);
 }
 
-int	execute_single_command(t_cmd *cmd, t_shell *shell)
+/**
+ * @brief Runs the command in a child: spawned when it is an external
+ * program, forked otherwise or when spawning fails
+ */
+static int	run_in_child(t_cmd *cmd, t_shell *shell)
 {
+	int		no_pipe[2];
+	t_stage	*stage;
 	pid_t	pid;
-	int		result;
 
+	if (shell->exec_in_place && !cmd->builtin)
+		return (handle_child_process(cmd, shell));
+	no_pipe[0] = -1;
+	no_pipe[1] = -1;
+	stage = stages_add(&shell->stages);
+	pid = spawn_command(cmd, no_pipe, -1, shell);
+	if (pid < 0)
+		pid = fork_command(cmd, shell);
+	if (pid == 0)
+		return (handle_child_process(cmd, shell));
+	stage->pid = pid;
+	shell->stages.running = 1;
+	return (handle_parent_process(cmd, pid, shell));
+}
+
+/**
+ * @brief Runs a command that is a pipeline of its own, recorded as the
+ * only stage in shell->stages
+ */
+int	execute_single_command(t_cmd *cmd, t_shell *shell)
+{
 	if (!cmd || !shell || !cmd->argv || !cmd->argv[0])
 		return (1);
+	if (stages_begin(&shell->stages, cmd))
+		return (print_error("pipeline", "Out of memory"), 1);
 	if (process_heredocs(cmd->redirs, shell))
 		return (EXIT_STATUS_SIGINT);
 	if (g_signal == SIGINT)
@@ -72,14 +107,8 @@ int	execute_single_command(t_cmd *cmd, t_shell *shell)
 		g_signal = 0;
 		return (EXIT_STATUS_SIGINT);
 	}
-	if (check_parent_builtin(cmd->argv[0]))
-	{
-		result = execute_builtin_with_redirections(cmd, shell);
-		cleanup_heredoc_fds(cmd);
-		return (result);
-	}
-	pid = fork();
-	if (pid == 0)
-		return (handle_child_process(cmd, shell));
-	return (handle_parent_process(cmd, pid));
+	if (builtin_get(cmd->builtin)->flags
+		& (BUILTIN_IN_PARENT | BUILTIN_IN_PIPELINE))
+		return (execute_builtin_alone(cmd, shell));
+	return (run_in_child(cmd, shell));
 }
@@ -0,0 +1,153 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   spawn_command.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/29 09:40:12 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/09/29 09:40:12 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "minishell.h"
+
+/**
+ * @brief Pipe ends, in the order setup_pipeline uses, as file actions
+ */
+static int	add_pipe_actions(posix_spawn_file_actions_t *actions,
+		int *pipe_fds, int prev_read_fd)
+{
+	if (prev_read_fd != -1
+		&& (posix_spawn_file_actions_adddup2(actions, prev_read_fd, 0)
+			|| posix_spawn_file_actions_addclose(actions, prev_read_fd)))
+		return (1);
+	if (pipe_fds[1] != -1
+		&& (posix_spawn_file_actions_adddup2(actions, pipe_fds[1], 1)
+			|| posix_spawn_file_actions_addclose(actions, pipe_fds[1])))
+		return (1);
+	if (pipe_fds[0] != -1
+		&& posix_spawn_file_actions_addclose(actions, pipe_fds[0]))
+		return (1);
+	return (0);
+}
+
+/**
+ * @brief SIGINT and SIGQUIT back to their defaults, nothing blocked, as
+ * the forked child does before execve
+ */
+static int	init_spawn_attr(posix_spawnattr_t *attr)
+{
+	sigset_t	signals;
+
+	if (posix_spawnattr_init(attr))
+		return (1);
+	sigemptyset(&signals);
+	sigaddset(&signals, SIGINT);
+	sigaddset(&signals, SIGQUIT);
+	if (posix_spawnattr_setsigdefault(attr, &signals) == 0)
+	{
+		sigemptyset(&signals);
+		if (posix_spawnattr_setsigmask(attr, &signals) == 0
+			&& posix_spawnattr_setflags(attr,
+				POSIX_SPAWN_SETSIGDEF | POSIX_SPAWN_SETSIGMASK) == 0)
+			return (0);
+	}
+	posix_spawnattr_destroy(attr);
+	return (1);
+}
+
+/**
+ * @brief Stands in for a command that could not be started once its
+ * redirections were opened: a child reports the error and exits with
+ * status, and nothing is opened again
+ * @return The child's pid, or -1 if fork failed
+ */
+static pid_t	spawn_failed(t_cmd *cmd, t_spawn_files *files, int status,
+		t_shell *shell)
+{
+	pid_t	pid;
+
+	pid = fork_command(cmd, shell);
+	if (pid == 0)
+	{
+		print_error(files->error_word, strerror(files->error));
+		shell_cleanup(shell);
+		exit(status);
+	}
+	return (pid);
+}
+
+/**
+ * @brief Runs posix_spawn with the file actions and attributes built, as
+ * a traced phase, and opens the child's track with its execve once it
+ * returns
+ * @details With the files already open, a failure can only come from the
+ * execve, reported as the fork path reports it.
+ * @return Child pid, or -1 if it failed
+ */
+static pid_t	spawn(t_cmd *cmd, posix_spawn_file_actions_t *actions,
+		posix_spawnattr_t *attr, t_shell *shell)
+{
+	t_spawn_files	failure;
+	pid_t			pid;
+	int				error;
+
+	out_flush(&shell->out);
+	trace_event(&shell->trace, "posix_spawn", TRACE_BEGIN);
+	error = posix_spawn(&pid, cmd->path, actions, attr, cmd->argv,
+			env_envp(&shell->env));
+	trace_event(&shell->trace, "posix_spawn", TRACE_END);
+	if (error)
+	{
+		failure.error_word = "execve";
+		failure.error = error;
+		return (spawn_failed(cmd, &failure, CMD_PERMISSION_DENIED, shell));
+	}
+	trace_child_start(&shell->trace, pid, cmd->argv[0]);
+	trace_execve(&shell->trace, pid, cmd->path);
+	shell->spawns++;
+	return (pid);
+}
+
+/**
+ * @brief Starts an external command with posix_spawn instead of fork
+ * @details posix_spawn shares the parent's memory until the exec, so its
+ * cost does not grow with the shell's heap as fork's does. Pipe ends,
+ * heredoc fds and signal resets become file actions and attributes; the
+ * files of the redirections are opened here and dup2'd by the child.
+ * Only what is checked before anything is opened (a builtin, an
+ * unresolved name, a redirection spawning cannot express) returns -1 and
+ * leaves the command to the fork path. A file that cannot be opened or a
+ * program that cannot be executed is reported by a child that does not
+ * perform the redirections again.
+ * @return Child pid, or -1 if the command must be forked instead
+ */
+pid_t	spawn_command(t_cmd *cmd, int *pipe_fds, int prev_read_fd,
+		t_shell *shell)
+{
+	posix_spawn_file_actions_t	actions;
+	posix_spawnattr_t			attr;
+	t_spawn_files				files;
+	pid_t						pid;
+
+	if (!cmd->path || !cmd->argv || !cmd->argv[0] || cmd->builtin
+		|| !spawn_redirs_supported(cmd->redirs)
+		|| posix_spawn_file_actions_init(&actions))
+		return (-1);
+	pid = -1;
+	files.count = 0;
+	if (!add_pipe_actions(&actions, pipe_fds, prev_read_fd)
+		&& !init_spawn_attr(&attr))
+	{
+		if (spawn_add_redirs(&actions, cmd->redirs, &files))
+			pid = spawn_failed(cmd, &files, 1, shell);
+		else
+			pid = spawn(cmd, &actions, &attr, shell);
+		spawn_close_files(&files);
+		posix_spawnattr_destroy(&attr);
+	}
+	posix_spawn_file_actions_destroy(&actions);
+	return (pid);
+}
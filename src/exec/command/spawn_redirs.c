@@ -0,0 +1,144 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   spawn_redirs.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/10/08 15:38:20 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/10/08 15:38:20 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Whether the redirections can all become file actions
+ * @details Only stdin, stdout and stderr are redirected here: every fd
+ * the parent passes down (pipe ends, heredoc bodies) is above 2, so
+ * performing them in order can never overwrite a later source. Other fds,
+ * ">&word" with a file word and fds that are not open leave the command
+ * to the fork path and its redirection plan. Nothing is opened yet.
+ */
+int	spawn_redirs_supported(t_redir *redir)
+{
+	int	files;
+	int	source;
+
+	files = 0;
+	while (redir)
+	{
+		if (redir->io_fd > STDERR_FILENO
+			|| (redir->type == REDIR_HEREDOC && redir->fd < 0))
+			return (0);
+		source = REDIR_DUP_CLOSE;
+		if (redir->type == REDIR_DUP_IN || redir->type == REDIR_DUP_OUT)
+			source = redir_dup_word(redir->file);
+		else if (redir->type != REDIR_HEREDOC)
+			files++;
+		if (source != REDIR_DUP_CLOSE && (source < 0 || source > REDIR_FD_MAX
+				|| fcntl(source, F_GETFD) == -1))
+			return (0);
+		redir = redir->next;
+	}
+	return (files <= SPAWN_FILES_MAX);
+}
+
+/**
+ * @brief Opens the file of a redirection in the shell, close-on-exec and
+ * above stderr so that only the dup2 onto its target reaches the program
+ * @return The fd, or -1 after recording the error in files
+ */
+static int	open_file(t_redir *r, t_spawn_files *files)
+{
+	int	flags;
+	int	fd;
+	int	moved;
+
+	flags = O_WRONLY | O_CREAT | O_TRUNC;
+	if (r->type == REDIR_IN)
+		flags = O_RDONLY;
+	else if (r->type == REDIR_APPEND)
+		flags = O_WRONLY | O_CREAT | O_APPEND;
+	fd = open(r->file, flags | O_CLOEXEC, 0644);
+	if (fd != -1 && fd <= STDERR_FILENO)
+	{
+		moved = fcntl(fd, F_DUPFD_CLOEXEC, REDIR_FD_BASE);
+		close(fd);
+		fd = moved;
+	}
+	if (fd == -1)
+	{
+		files->error_word = r->file;
+		files->error = errno;
+		return (-1);
+	}
+	files->fds[files->count++] = fd;
+	return (fd);
+}
+
+/**
+ * @brief One redirection as file actions
+ * @return 0, -1 if its file could not be opened, or another error of the
+ * file actions
+ */
+static int	add_redir_action(posix_spawn_file_actions_t *actions, t_redir *r,
+		t_spawn_files *files)
+{
+	int	source;
+
+	if (r->type == REDIR_HEREDOC)
+		return (posix_spawn_file_actions_adddup2(actions, r->fd, r->io_fd)
+			|| posix_spawn_file_actions_addclose(actions, r->fd));
+	if (r->type == REDIR_DUP_IN || r->type == REDIR_DUP_OUT)
+	{
+		source = redir_dup_word(r->file);
+		if (source == REDIR_DUP_CLOSE)
+			return (posix_spawn_file_actions_addclose(actions, r->io_fd));
+		return (posix_spawn_file_actions_adddup2(actions, source, r->io_fd));
+	}
+	source = open_file(r, files);
+	if (source == -1)
+		return (-1);
+	return (posix_spawn_file_actions_adddup2(actions, source, r->io_fd)
+		|| (r->type == REDIR_OUT_ALL
+			&& posix_spawn_file_actions_adddup2(actions, 1, 2)));
+}
+
+/**
+ * @brief Opens the files of the redirections in command order, as the
+ * fork path would, and adds the actions that apply them
+ * @details A file is opened once, here: when the command cannot start
+ * afterwards, nothing is truncated, created or opened on a FIFO again.
+ * @return 0, or 1 with the error in files
+ */
+int	spawn_add_redirs(posix_spawn_file_actions_t *actions, t_redir *redir,
+		t_spawn_files *files)
+{
+	int	result;
+
+	while (redir)
+	{
+		result = add_redir_action(actions, redir, files);
+		if (result == -1)
+			return (1);
+		if (result)
+		{
+			files->error_word = "posix_spawn";
+			files->error = ENOMEM;
+			return (1);
+		}
+		redir = redir->next;
+	}
+	return (0);
+}
+
+/**
+ * @brief Closes the files spawn_add_redirs opened, once the command is
+ * started or has failed
+ */
+void	spawn_close_files(t_spawn_files *files)
+{
+	while (files->count > 0)
+		close(files->fds[--files->count]);
+}
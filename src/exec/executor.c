@@ -13,31 +13,96 @@
 #include "minishell.h"
 
 /**
- * @brief Executes a command list, choosing between single command or pipeline
+ * @brief Expands and runs one pipeline, choosing between single command
+ * or pipeline
+ * @details Its stages become shell->last_stages, read by $PIPESTATUS and
+ * stats -p; a pipeline that stopped before any stage ran has one stage
+ * with its status.
  * @param cmd_list Linked list of commands to execute
  * @param shell Shell context with environment and state
  * @return Exit status of the executed commands
  */
-int	execute_command_list(t_cmd *cmd_list, t_shell *shell)
+static int	execute_pipeline_node(t_cmd *cmd_list, t_shell *shell)
 {
-	t_cmd	*current;
-	int		status;
+	int	status;
 
-	if (!cmd_list || !shell)
+	if (stages_begin(&shell->stages, cmd_list))
+		return (print_error("pipeline", "Out of memory"), 1);
+	trace_event(&shell->trace, "expansion", TRACE_BEGIN);
+	status = expand_command_list(cmd_list, shell);
+	trace_event(&shell->trace, "expansion", TRACE_END);
+	if (status)
+		return (print_error("expansion", "Out of memory"), 1);
+	resolve_command_paths(cmd_list, shell);
+	shell->current_cmd_list = cmd_list;
+	if (cmd_list->next)
+		status = execute_pipeline(cmd_list, shell);
+	else
+		status = execute_single_command(cmd_list, shell);
+	shell->current_cmd_list = NULL;
+	if (!shell->stages.count)
+		stages_add(&shell->stages)->status = status;
+	stages_swap(&shell->stages, &shell->last_stages);
+	shell->last_status = status;
+	return (status);
+}
+
+/**
+ * @brief Runs one pipeline of a list, and reports its times when the time
+ * reserved word is in front of it
+ * @details The clock starts before the expansion, as the pipeline's real
+ * time in bash does; the CPU time is that of its stages, found in
+ * last_stages once it has run.
+ */
+static int	execute_list_node(t_pipeline *node, t_shell *shell)
+{
+	struct timespec	start;
+	int				status;
+
+	if (!node->timed)
+		return (execute_pipeline_node(node->cmds, shell));
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	if (!node->cmds)
+	{
+		time_report(shell, node->timed, &start, NULL);
+		return (0);
+	}
+	status = execute_pipeline_node(node->cmds, shell);
+	time_report(shell, node->timed, &start, &shell->last_stages);
+	return (status);
+}
+
+/**
+ * @brief Runs a command list with short-circuit evaluation
+ * @details '&&' and '||' look at the status of the last pipeline that ran,
+ * which gives the left-associative behaviour of a && b || c. The list
+ * stops on exit or when a pipeline is interrupted by SIGINT. Only the
+ * final pipeline may replace the shell in -c mode, unless it is timed.
+ * @return Exit status of the last pipeline that ran
+ */
+int	execute_command_list(t_pipeline *list, t_shell *shell)
+{
+	int	status;
+	int	run;
+	int	in_place;
+
+	if (!list || !shell)
 		return (1);
-	current = cmd_list;
-	if (current->next)
+	in_place = shell->exec_in_place;
+	status = shell->last_status;
+	run = 1;
+	while (list && !shell->should_exit)
 	{
-		if (current->argv && ft_strcmp(current->argv[0], "cd") == 0
-			&& !current->next)
-			status = builtin_cd(current->argv, shell);
-		else
-			status = execute_pipeline(cmd_list, shell);
+		shell->exec_in_place = in_place && !list->next && !list->timed;
+		if (run)
+			status = execute_list_node(list, shell);
+		if (run && status == 128 + SIGINT)
+			break ;
+		run = list->op == LIST_SEQ || (list->op == LIST_AND && status == 0)
+			|| (list->op == LIST_OR && status != 0);
+		list = list->next;
 	}
-	else
-		status = execute_single_command(current, shell);
-	if (shell)
-		shell->last_status = status;
+	shell->exec_in_place = 0;
 	return (status);
 }
 
@@ -55,7 +120,7 @@ void	execute_child_command(t_cmd *cmd, t_shell *shell)
 		shell_cleanup(shell);
 		exit(1);
 	}
-	if (is_builtin(cmd->argv[0]))
+	if (cmd->builtin)
 		exit_code = execute_builtin_in_child(cmd, shell);
 	else
 		exit_code = execute_external_in_child(cmd, shell);
@@ -12,79 +12,78 @@
 
 #include "minishell.h"
 
-static char	*prompt_heredoc_line(void)
+/**
+ * @brief Reads one body line: a view into the input buffer when reading
+ * a script, a readline allocation otherwise
+ */
+static char	*prompt_heredoc_line(t_shell *shell, size_t *len)
 {
 	char	*line;
 
+	if (!shell->is_interactive)
+		return (input_next_line(&shell->input, len));
 	line = readline("> ");
 	if (!line || g_signal == SIGINT)
 		return (NULL);
+	*len = ft_strlen(line);
 	return (line);
 }
 
-static int	handle_null_line(int *fds)
-{
-	if (g_signal == SIGINT)
-	{
-		close(fds[0]);
-		close(fds[1]);
-		return (-1);
-	}
-	return (0);
-}
-
-static int	process_heredoc_content(char *line, t_redir *r,
-		int *fds, t_shell *shell)
-{
-	if (is_delimiter(line, r->file))
-	{
-		free(line);
-		return (1);
-	}
-	if (process_heredoc_line_with_expand(line, r, fds[1], shell) == -1)
-	{
-		close(fds[0]);
-		close(fds[1]);
-		return (-1);
-	}
-	return (0);
-}
-
-static int	handle_heredoc_input(t_redir *r, int *fds, t_shell *shell)
+/**
+ * @return 0 at the delimiter or end of input, -1 on SIGINT or error
+ */
+static int	handle_heredoc_input(t_redir *r, t_expander *stream,
+		t_shell *shell)
 {
 	char	*line;
+	size_t	len;
 	int		result;
 
 	while (1)
 	{
-		line = prompt_heredoc_line();
+		line = prompt_heredoc_line(shell, &len);
+		if (!line && g_signal == SIGINT)
+			return (-1);
 		if (!line)
-			return (handle_null_line(fds));
-		result = process_heredoc_content(line, r, fds, shell);
-		if (result != 0)
-		{
-			if (result == 1)
-				return (0);
-			else
-				return (result);
-		}
+			return (0);
+		result = 1;
+		if (!is_delimiter(line, r->file))
+			result = heredoc_write_line(stream, r, line, len);
+		if (shell->is_interactive)
+			free(line);
+		if (result == 1)
+			return (0);
+		if (result == -1)
+			return (-1);
 	}
 	return (0);
 }
 
+/**
+ * @brief Reads a heredoc body into anonymous storage and rewinds it
+ * @details The body is stored whole before any child starts, in a file
+ * rather than a pipe, so a body of any size is written without blocking.
+ * Lines go through a streaming expander that writes in large blocks.
+ * r->fd is left at offset 0, ready to become the command's stdin.
+ */
 int	build_heredoc_fd(t_redir *r, t_shell *shell)
 {
-	int	fds[2];
-	int	result;
+	t_expander	stream;
+	int			fd;
 
-	if (pipe(fds) == -1)
-		return (perror("pipe"), -1);
+	fd = heredoc_open_storage(shell);
+	if (fd == -1)
+		return (print_error("heredoc", strerror(errno)), -1);
 	setup_heredoc_signals();
-	result = handle_heredoc_input(r, fds, shell);
-	if (result == -1)
+	expander_begin(&stream, shell);
+	if (expander_stream(&stream, fd)
+		|| handle_heredoc_input(r, &stream, shell) == -1
+		|| expander_flush(&stream) || lseek(fd, 0, SEEK_SET) == -1)
+	{
+		close(fd);
 		return (-1);
-	close(fds[1]);
-	r->fd = fds[0];
+	}
+	r->fd = fd;
 	signal_setup_interactive();
 	return (0);
 }
@@ -28,25 +28,24 @@ int	write_full(int fd, const char *buf, size_t len)
 	return (0);
 }
 
-int	process_heredoc_line_with_expand(char *line, t_redir *r,
-	int fd, t_shell *shell)
+/**
+ * @brief Appends one body line and its newline to the heredoc stream
+ * @details The line is expanded with quotes kept literal, as bash does,
+ * unless the delimiter was quoted. The stream writes to the heredoc fd
+ * in large blocks, so a line costs no allocation and no syscall.
+ * @return 0 on success, -1 on allocation or write failure
+ */
+int	heredoc_write_line(t_expander *stream, t_redir *r, const char *line,
+		size_t len)
 {
-	char	*expanded;
-
-	if (r->expand && shell)
-		expanded = expand_string(line, shell, QUOTE_NONE);
-	else
-		expanded = line;
-	if (write_full(fd, expanded, ft_strlen(expanded)) == -1
-		|| write_full(fd, "\n", 1) == -1)
+	if (r->expand && stream->shell)
 	{
-		if (expanded != line)
-			free(expanded);
-		free(line);
-		return (-1);
+		if (expander_feed(stream, line, len, QUOTE_HEREDOC))
+			return (-1);
 	}
-	if (expanded != line)
-		free(expanded);
-	free(line);
+	else if (expander_append_span(stream, line, len))
+		return (-1);
+	if (expander_append_char(stream, '\n'))
+		return (-1);
 	return (0);
 }
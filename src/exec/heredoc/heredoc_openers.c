@@ -1,44 +1,42 @@
 /* ************************************************************************** */
 /*                                                                            */
 /*                                                        :::      ::::::::   */
-/*   quote_handling.c                                   :+:      :+:    :+:   */
+/*   heredoc_openers.c                                  :+:      :+:    :+:   */
 /*                                                    +:+ +:+         +:+     */
 /*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
-/*   Created: 2025/09/03 22:00:00 by tmarcos           #+#    #+#             */
-/*   Updated: 2025/09/16 21:05:37 by tmarcos          ###   ########.fr       */
+/*   Created: 2025/10/08 14:41:09 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/10/08 14:41:09 by tmarcos          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "minishell.h"
+#include <sys/mman.h>
 
-char	*process_quotes(char *str, t_shell *sh)
+#ifdef MFD_CLOEXEC
+
+int	heredoc_open_memfd(void)
 {
-	char	*result;
+	return (memfd_create("minishell-heredoc", MFD_CLOEXEC));
+}
+#else
 
-	(void)sh;
-	if (!str)
-		return (NULL);
-	result = ft_strdup(str);
-	return (result);
+int	heredoc_open_memfd(void)
+{
+	return (-1);
 }
+#endif
+#ifdef O_TMPFILE
 
-int	has_unclosed_quotes(char *str)
+int	heredoc_open_tmpfile(const char *dir)
 {
-	int	i;
-	int	in_single;
-	int	in_double;
+	return (open(dir, O_TMPFILE | O_RDWR | O_CLOEXEC, 0600));
+}
+#else
 
-	i = 0;
-	in_single = 0;
-	in_double = 0;
-	while (str[i])
-	{
-		if (str[i] == '\'' && !in_double)
-			in_single = !in_single;
-		else if (str[i] == '"' && !in_single)
-			in_double = !in_double;
-		i++;
-	}
-	return (in_single || in_double);
+int	heredoc_open_tmpfile(const char *dir)
+{
+	(void)dir;
+	return (-1);
 }
+#endif
@@ -0,0 +1,56 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   heredoc_storage.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/29 14:20:47 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/09/29 14:20:47 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "minishell.h"
+
+/**
+ * @brief Last resort where neither memfd nor O_TMPFILE exist: a named
+ * file that is unlinked straight away
+ */
+static int	open_unlinked(void)
+{
+	char	path[32];
+	int		fd;
+
+	ft_strlcpy(path, "/tmp/minishell-heredoc-XXXXXX", sizeof(path));
+	fd = mkstemp(path);
+	if (fd == -1)
+		return (-1);
+	unlink(path);
+	return (fd);
+}
+
+/**
+ * @brief Opens an anonymous, seekable file for a heredoc body
+ * @details A memfd (or an O_TMPFILE file in $TMPDIR or /tmp) holds a
+ * body of any size: unlike a pipe, writing it cannot block before the
+ * reader exists. The fd is close-on-exec; dup2 onto stdin clears that.
+ * @return The fd, or -1 with errno set
+ */
+int	heredoc_open_storage(t_shell *shell)
+{
+	const char	*dir;
+	int			fd;
+
+	fd = heredoc_open_memfd();
+	if (fd != -1)
+		return (fd);
+	dir = env_get(&shell->env, "TMPDIR");
+	if (dir && *dir)
+		fd = heredoc_open_tmpfile(dir);
+	if (fd == -1)
+		fd = heredoc_open_tmpfile("/tmp");
+	if (fd == -1)
+		fd = open_unlinked();
+	return (fd);
+}
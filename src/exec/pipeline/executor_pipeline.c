@@ -15,33 +15,36 @@
 static int	get_child_exit_status(int status)
 {
 	if (WIFSIGNALED(status))
-	{
-		if (WTERMSIG(status) == SIGQUIT)
-			ft_putstr_fd("Quit: 3\n", STDERR_FILENO);
 		return (EXIT_STATUS_SIGNAL_BASE + WTERMSIG(status));
-	}
 	return (WEXITSTATUS(status));
 }
 
 static int	process_single_pipeline_cmd(t_cmd **current, t_shell *shell,
 	int *pipe_fds, int *prev_read_fd)
 {
+	t_stage	*stage;
 	pid_t	pid;
 
+	stage = stages_add(&shell->stages);
+	if ((*current)->in_shell)
+		return (pipeline_keep_stage(current, pipe_fds, prev_read_fd));
 	pid = setup_pipeline_process(*current, pipe_fds, *prev_read_fd, shell);
 	if (pid < 0)
 		return (-1);
+	stage->pid = pid;
+	shell->stages.running++;
 	execute_pipeline_parent(current, pipe_fds, prev_read_fd);
 	return (pid);
 }
 
 static int	setup_pipeline_execution(t_cmd *cmd_list, t_shell *shell,
-	int *pipe_fds, pid_t *last_pid)
+	int *pipe_fds)
 {
 	t_cmd	*current;
 	int		prev_read_fd;
 	int		pid;
 
+	pipeline_plan_stages(cmd_list);
 	current = cmd_list;
 	prev_read_fd = -1;
 	while (current)
@@ -50,46 +53,69 @@ static int	setup_pipeline_execution(t_cmd *cmd_list, t_shell *shell,
 				pipe_fds, &prev_read_fd);
 		if (pid < 0)
 		{
+			pipeline_close_stages(cmd_list);
 			cleanup_pipeline_heredoc_fds(cmd_list);
 			return (1);
 		}
-		*last_pid = pid;
 	}
 	return (0);
 }
 
-static int	wait_for_children(pid_t last_pid)
+/**
+ * @brief Reaps the children of the pipeline with wait4 in the order they
+ * exit, recording the status and resource usage of each stage
+ * @details Only the last stage reports "Quit", as in bash.
+ */
+static void	wait_for_children(t_stages *stages, const t_trace *trace)
 {
-	int	status;
-	int	last_status;
+	struct rusage	usage;
+	t_stage			*stage;
+	int				status;
+	pid_t			pid;
 
 	status = 0;
-	last_status = EXIT_SUCCESS;
-	if (waitpid(last_pid, &status, 0) > 0)
-		last_status = get_child_exit_status(status);
-	while (wait(&status) > 0)
-		;
-	return (last_status);
+	while (stages->running)
+	{
+		trace_event(trace, "wait4", TRACE_BEGIN);
+		pid = wait4(-1, &status, 0, &usage);
+		trace_event(trace, "wait4", TRACE_END);
+		if (pid == -1 && errno != EINTR)
+			break ;
+		stage = stages_reap(stages, pid, get_child_exit_status(status),
+				&usage);
+		if (stage)
+			trace_child_end(trace, pid, stage->status);
+		if (stage && stage == &stages->items[stages->count - 1]
+			&& WIFSIGNALED(status) && WTERMSIG(status) == SIGQUIT)
+			ft_putstr_fd("Quit: 3\n", STDERR_FILENO);
+	}
 }
 
+/**
+ * @brief Runs a pipeline of two or more commands and records its stages
+ * in shell->stages
+ * @return Status of the last stage, or of the last failing one with
+ * pipefail
+ */
 int	execute_pipeline(t_cmd *cmd_list, t_shell *shell)
 {
 	int		pipe_fds[2];
 	int		result;
-	int		last_status;
-	pid_t	last_pid;
 
 	if (!cmd_list || !shell)
 		return (1);
+	if (stages_begin(&shell->stages, cmd_list))
+		return (print_error("pipeline", "Out of memory"), 1);
 	result = process_pipeline_heredocs(cmd_list, shell);
 	if (result)
 	{
 		cleanup_pipeline_heredoc_fds(cmd_list);
 		return (result);
 	}
-	if (setup_pipeline_execution(cmd_list, shell, pipe_fds, &last_pid))
+	if (setup_pipeline_execution(cmd_list, shell, pipe_fds))
 		return (1);
-	last_status = wait_for_children(last_pid);
+	pipeline_run_stages(cmd_list, shell);
+	wait_for_children(&shell->stages, &shell->trace);
 	cleanup_pipeline_heredoc_fds(cmd_list);
-	return (last_status);
+	return (stages_result(&shell->stages, shell->pipefail));
 }
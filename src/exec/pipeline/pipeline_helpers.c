@@ -17,6 +17,7 @@ int	execute_pipeline_child(t_cmd *cmd, int *pipe_fds,
 {
 	int	exit_code;
 
+	pipeline_close_stages(shell->current_cmd_list);
 	setup_pipeline(cmd, pipe_fds, prev_read_fd);
 	if (setup_redirections(cmd->redirs))
 	{
@@ -28,7 +29,7 @@ int	execute_pipeline_child(t_cmd *cmd, int *pipe_fds,
 		shell_cleanup(shell);
 		exit(1);
 	}
-	if (is_builtin(cmd->argv[0]))
+	if (cmd->builtin)
 		exit_code = execute_builtin_in_child(cmd, shell);
 	else
 		exit_code = execute_external_in_child(cmd, shell);
@@ -17,7 +17,10 @@ static pid_t	create_pipeline_process(t_cmd *current, int *pipe_fds,
 {
 	pid_t	pid;
 
-	pid = fork();
+	pid = spawn_command(current, pipe_fds, prev_read_fd, shell);
+	if (pid > 0)
+		return (pid);
+	pid = fork_command(current, shell);
 	if (pid == 0)
 		execute_pipeline_child(current, pipe_fds, prev_read_fd, shell);
 	return (pid);
@@ -0,0 +1,87 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pipeline_stage.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/10/05 10:03:27 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/10/05 10:03:27 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Chooses the stage of a pipeline that runs in the shell
+ * @details Only builtins that leave the shell as it is qualify: cd or
+ * export in a pipeline keep the subshell semantics of a child. The stage
+ * in the shell runs after every child of the pipeline, readers after it
+ * included, is started, so at most one can: another in-shell stage would
+ * have to wait for it, or it for a writer that has not run yet. That is
+ * a deliberate limit: the last builtin that qualifies is kept, final
+ * stage or not, and the builtins before it run in children, so a pipeline
+ * saves one fork rather than one per builtin stage.
+ */
+void	pipeline_plan_stages(t_cmd *cmd_list)
+{
+	t_cmd	*last;
+
+	last = NULL;
+	while (cmd_list)
+	{
+		cmd_list->in_shell = 0;
+		if (builtin_get(cmd_list->builtin)->flags & BUILTIN_IN_PIPELINE)
+			last = cmd_list;
+		cmd_list = cmd_list->next;
+	}
+	if (last)
+		last->in_shell = 1;
+}
+
+/**
+ * @brief Keeps the pipe ends of an in-shell stage for when it runs,
+ * close-on-exec so that no program started meanwhile inherits them
+ * @return 0, or -1 if the pipe could not be created
+ */
+int	pipeline_keep_stage(t_cmd **current, int *pipe_fds, int *prev_read_fd)
+{
+	t_cmd	*cmd;
+
+	cmd = *current;
+	cmd->stage_in = *prev_read_fd;
+	*prev_read_fd = -1;
+	if (cmd->stage_in != -1)
+		fcntl(cmd->stage_in, F_SETFD, FD_CLOEXEC);
+	if (cmd->next && pipe(pipe_fds) == -1)
+		return (-1);
+	if (cmd->next)
+	{
+		cmd->stage_out = pipe_fds[1];
+		fcntl(cmd->stage_out, F_SETFD, FD_CLOEXEC);
+		*prev_read_fd = pipe_fds[0];
+	}
+	*current = cmd->next;
+	return (0);
+}
+
+/**
+ * @brief Closes the pipe ends kept for the in-shell stage: in a child that
+ * does not exec, and when the pipeline cannot be started
+ */
+void	pipeline_close_stages(t_cmd *cmd_list)
+{
+	while (cmd_list)
+	{
+		if (cmd_list->in_shell && cmd_list->stage_in != -1)
+			close(cmd_list->stage_in);
+		if (cmd_list->in_shell && cmd_list->stage_out != -1)
+			close(cmd_list->stage_out);
+		if (cmd_list->in_shell)
+		{
+			cmd_list->stage_in = -1;
+			cmd_list->stage_out = -1;
+		}
+		cmd_list = cmd_list->next;
+	}
+}
@@ -0,0 +1,92 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pipeline_stage_run.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/10/05 10:41:05 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/10/05 10:41:05 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Discards what the writers before a finished in-shell stage still
+ * send, at most STAGE_DRAIN_MAX bytes, then closes the pipe
+ * @details The stage runs as soon as every child is started, so closing
+ * its input straight away would kill a writer that has not written yet
+ * with SIGPIPE. A writer with more to send than STAGE_DRAIN_MAX still
+ * gets EPIPE, or status 141, once the pipe is closed.
+ */
+static void	drain_input(int fd)
+{
+	char	buf[4096];
+	size_t	total;
+	ssize_t	n;
+
+	total = 0;
+	n = 1;
+	while (n > 0 && total < STAGE_DRAIN_MAX)
+	{
+		n = read(fd, buf, sizeof(buf));
+		if (n > 0)
+			total += n;
+	}
+	close(fd);
+}
+
+/**
+ * @brief Runs one in-shell stage on its pipe ends, as a child would, and
+ * records it
+ * @details Variables a loaded builtin sets are dropped meanwhile, as they
+ * would be with the child.
+ */
+static void	run_stage(t_cmd *cmd, t_stage *stage, t_shell *shell)
+{
+	struct rusage	before;
+	int				status;
+	int				input;
+
+	input = -1;
+	if (cmd->stage_in != -1)
+		input = fcntl(cmd->stage_in, F_DUPFD_CLOEXEC, REDIR_FD_BASE);
+	clock_gettime(CLOCK_MONOTONIC, &stage->start);
+	getrusage(RUSAGE_SELF, &before);
+	shell->in_stage = 1;
+	status = execute_builtin_with_redirections(cmd, shell);
+	shell->in_stage = 0;
+	stage_end_self(stage, status, &before);
+	if (input != -1)
+		drain_input(input);
+}
+
+/**
+ * @brief Runs the in-shell stage of a pipeline after every child, the
+ * readers after it included, is started
+ * @details SIGPIPE is ignored meanwhile, so a stage writing to a reader
+ * that is gone gets EPIPE instead of killing the shell; builtin_flush
+ * turns that into the status the signal gives a child. Its record is the
+ * entry of shell->stages at the same position.
+ */
+void	pipeline_run_stages(t_cmd *cmd_list, t_shell *shell)
+{
+	struct sigaction	ignore;
+	struct sigaction	saved;
+	size_t				i;
+
+	ft_bzero(&ignore, sizeof(ignore));
+	ignore.sa_handler = SIG_IGN;
+	sigemptyset(&ignore.sa_mask);
+	sigaction(SIGPIPE, &ignore, &saved);
+	i = 0;
+	while (cmd_list)
+	{
+		if (cmd_list->in_shell)
+			run_stage(cmd_list, &shell->stages.items[i], shell);
+		cmd_list = cmd_list->next;
+		i++;
+	}
+	sigaction(SIGPIPE, &saved, NULL);
+}
@@ -0,0 +1,98 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   stages.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/10/06 09:58:40 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/10/06 09:58:40 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Starts the record of a pipeline, with room for all its stages
+ * @details The table only grows, so a session of short pipelines never
+ * allocates; nothing is carried over when it does.
+ * @return 0, or 1 if there is no memory for the stages
+ */
+int	stages_begin(t_stages *stages, t_cmd *cmd_list)
+{
+	size_t	n;
+
+	n = 0;
+	while (cmd_list)
+	{
+		n++;
+		cmd_list = cmd_list->next;
+	}
+	stages->count = 0;
+	stages->running = 0;
+	stages->text_valid = 0;
+	if (n <= stages->cap)
+		return (0);
+	free(stages->items);
+	free(stages->text);
+	stages->items = malloc(sizeof(t_stage) * n);
+	stages->text = malloc(n * STAGE_STATUS_WIDTH + 1);
+	stages->cap = n;
+	if (stages->items && stages->text)
+		return (0);
+	stages_clear(stages);
+	return (1);
+}
+
+/**
+ * @brief Appends the next stage, started now; stages_begin made room
+ */
+t_stage	*stages_add(t_stages *stages)
+{
+	t_stage	*stage;
+
+	stage = &stages->items[stages->count++];
+	ft_bzero(stage, sizeof(*stage));
+	clock_gettime(CLOCK_MONOTONIC, &stage->start);
+	stage->end = stage->start;
+	return (stage);
+}
+
+/**
+ * @brief Records a child of the pipeline that wait4 returned
+ * @return Its stage, or NULL if pid is not one of them
+ */
+t_stage	*stages_reap(t_stages *stages, pid_t pid, int status,
+		const struct rusage *usage)
+{
+	size_t	i;
+
+	i = 0;
+	while (i < stages->count && stages->items[i].pid != pid)
+		i++;
+	if (pid <= 0 || i == stages->count)
+		return (NULL);
+	stage_end(&stages->items[i], status, usage);
+	stages->running--;
+	return (&stages->items[i]);
+}
+
+/**
+ * @brief Exchanges two records: the pipeline that just ran becomes the
+ * last one while the table of the one before is reused
+ */
+void	stages_swap(t_stages *a, t_stages *b)
+{
+	t_stages	tmp;
+
+	tmp = *a;
+	*a = *b;
+	*b = tmp;
+}
+
+void	stages_clear(t_stages *stages)
+{
+	free(stages->items);
+	free(stages->text);
+	ft_bzero(stages, sizeof(*stages));
+}
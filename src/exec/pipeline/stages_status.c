@@ -0,0 +1,94 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   stages_status.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/10/06 10:37:22 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/10/06 10:37:22 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Ends a stage now with status and the usage wait4 reported
+ */
+void	stage_end(t_stage *stage, int status, const struct rusage *usage)
+{
+	clock_gettime(CLOCK_MONOTONIC, &stage->end);
+	stage->status = status;
+	stage->utime = usage->ru_utime;
+	stage->stime = usage->ru_stime;
+	stage->maxrss = usage->ru_maxrss;
+}
+
+/**
+ * @brief Ends a stage the shell ran itself: its CPU time is what the
+ * shell used since before, its peak RSS the shell's
+ */
+void	stage_end_self(t_stage *stage, int status, const struct rusage *before)
+{
+	struct rusage	now;
+
+	getrusage(RUSAGE_SELF, &now);
+	timersub(&now.ru_utime, &before->ru_utime, &now.ru_utime);
+	timersub(&now.ru_stime, &before->ru_stime, &now.ru_stime);
+	stage_end(stage, status, &now);
+}
+
+/**
+ * @brief Status of the pipeline: its last stage's, or with pipefail the
+ * last non-zero one
+ */
+int	stages_result(const t_stages *stages, int pipefail)
+{
+	size_t	i;
+
+	if (!stages->count)
+		return (0);
+	i = stages->count - 1;
+	while (pipefail && i > 0 && stages->items[i].status == 0)
+		i--;
+	return (stages->items[i].status);
+}
+
+/**
+ * @brief Returns $PIPESTATUS, the statuses of the stages separated by
+ * spaces, formatted once per pipeline
+ */
+const char	*stages_status_str(t_stages *stages)
+{
+	char	*number;
+	size_t	len;
+	size_t	i;
+
+	if (!stages->text)
+		return ("");
+	if (stages->text_valid)
+		return (stages->text);
+	len = 0;
+	i = 0;
+	while (i < stages->count)
+	{
+		if (i)
+			stages->text[len++] = ' ';
+		number = ft_itoa(stages->items[i++].status);
+		if (number)
+			len += ft_strlcpy(stages->text + len, number, STAGE_STATUS_WIDTH);
+		free(number);
+	}
+	stages->text[len] = '\0';
+	stages->text_valid = 1;
+	return (stages->text);
+}
+
+/**
+ * @brief Wall time of a stage, from its start until it was reaped
+ */
+long	stage_real_usec(const t_stage *stage)
+{
+	return ((stage->end.tv_sec - stage->start.tv_sec) * 1000000L
+		+ (stage->end.tv_nsec - stage->start.tv_nsec) / 1000);
+}
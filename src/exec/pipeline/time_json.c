@@ -0,0 +1,68 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   time_json.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/10/07 10:54:20 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/10/07 10:54:20 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+static void	put_times(t_outbuf *out, const t_times *times, int precision)
+{
+	out_puts(out, "\"real\":");
+	out_putseconds(out, times->real, precision);
+	out_puts(out, ",\"user\":");
+	out_putseconds(out, times->user, precision);
+	out_puts(out, ",\"sys\":");
+	out_putseconds(out, times->sys, precision);
+}
+
+static void	put_stage(t_outbuf *out, const t_stage *stage, int precision)
+{
+	t_times	times;
+
+	stage_times(stage, &times);
+	out_puts(out, "{\"pid\":");
+	out_putnbr(out, stage->pid);
+	out_puts(out, ",\"status\":");
+	out_putnbr(out, stage->status);
+	out_putc(out, ',');
+	put_times(out, &times, precision);
+	out_puts(out, ",\"maxrss\":");
+	out_putnbr(out, stage->maxrss);
+	out_putc(out, '}');
+}
+
+/**
+ * @brief Appends the times of a pipeline as one JSON object, for TIMEFORMAT
+ * %J: real, user and sys seconds, and a "stages" array with the pid (0 for
+ * a stage the shell ran), status, times and peak RSS of each stage
+ * @details Every value is a plain JSON number, so the object can be
+ * parsed as it is; stages is empty for a time with no pipeline. A
+ * negative precision gives every microsecond.
+ */
+void	time_put_json(t_outbuf *out, const t_times *times,
+		const t_stages *stages, int precision)
+{
+	size_t	i;
+
+	if (precision < 0)
+		precision = TIME_PRECISION_MAX;
+	out_putc(out, '{');
+	put_times(out, times, precision);
+	out_puts(out, ",\"stages\":[");
+	i = 0;
+	while (stages && i < stages->count)
+	{
+		if (i)
+			out_putc(out, ',');
+		put_stage(out, &stages->items[i], precision);
+		i++;
+	}
+	out_puts(out, "]}");
+}
@@ -0,0 +1,108 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   time_report.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/10/07 11:20:36 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/10/07 11:20:36 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+static long	time_value(const t_times *times, char c)
+{
+	if (c == 'R')
+		return (times->real);
+	if (c == 'U')
+		return (times->user);
+	return (times->sys);
+}
+
+/**
+ * @brief Appends one TIMEFORMAT sequence; fmt is past its '%'
+ * @details %[p][l]R, %[p][l]U and %[p][l]S are the real, user and sys
+ * seconds with p decimals (3 by default, up to 6 where bash stops at 3),
+ * l for the 1m2.250s form; %P is the CPU percentage, %[p]J a JSON object
+ * (6 decimals by default) and %% a '%'. Anything else is kept as written.
+ * @return Where the format goes on
+ */
+static const char	*put_sequence(t_outbuf *out, const char *fmt,
+		const t_times *times, const t_stages *stages)
+{
+	const char	*start;
+	int			precision;
+	int			long_form;
+
+	start = fmt;
+	precision = -1;
+	if (ft_isdigit(*fmt))
+		precision = *fmt++ - '0';
+	if (precision > TIME_PRECISION_MAX)
+		precision = TIME_PRECISION_MAX;
+	long_form = (*fmt == 'l');
+	fmt += long_form;
+	if (*fmt == 'R' || *fmt == 'U' || *fmt == 'S')
+		time_put(out, time_value(times, *fmt), precision, long_form);
+	else if (*fmt == 'P' && fmt == start)
+		time_put_percent(out, times);
+	else if (*fmt == 'J' && !long_form)
+		time_put_json(out, times, stages, precision);
+	else if (*fmt == '%' && fmt == start)
+		out_putc(out, '%');
+	else
+		return (out_putc(out, '%'), start);
+	return (fmt + 1);
+}
+
+static void	put_format(t_outbuf *out, const char *fmt, const t_times *times,
+		const t_stages *stages)
+{
+	const char	*next;
+
+	while (*fmt)
+	{
+		next = ft_strchr(fmt, '%');
+		if (!next)
+			next = fmt + ft_strlen(fmt);
+		out_write(out, fmt, next - fmt);
+		fmt = next;
+		if (*fmt == '%')
+			fmt = put_sequence(out, fmt + 1, times, stages);
+	}
+}
+
+/**
+ * @brief Prints the times of a pipeline run after the time reserved word
+ * to the shell's stderr, whatever the pipeline redirected
+ * @details The real time runs from start, taken before the pipeline was
+ * expanded, to now; user and sys add up the rusage of its stages (NULL
+ * for time alone). The format is TIMEFORMAT, bash's default when unset
+ * and nothing when empty, or POSIX's for time -p; a newline ends it.
+ */
+void	time_report(t_shell *shell, int mode, const struct timespec *start,
+		const t_stages *stages)
+{
+	struct timespec	end;
+	t_times			times;
+	t_outbuf		out;
+	const char		*fmt;
+
+	clock_gettime(CLOCK_MONOTONIC, &end);
+	times.real = (end.tv_sec - start->tv_sec) * 1000000L
+		+ (end.tv_nsec - start->tv_nsec) / 1000;
+	stages_times(stages, &times);
+	fmt = TIMEFORMAT_POSIX;
+	if (mode != TIME_REPORT_POSIX)
+		fmt = env_get(&shell->env, TIMEFORMAT_VAR);
+	if (mode != TIME_REPORT_POSIX && !fmt)
+		fmt = TIMEFORMAT_DEFAULT;
+	if (!*fmt)
+		return ;
+	out_init(&out, STDERR_FILENO);
+	put_format(&out, fmt, &times, stages);
+	out_putc(&out, '\n');
+	out_flush(&out);
+}
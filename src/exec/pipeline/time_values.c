@@ -0,0 +1,84 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   time_values.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/10/07 10:31:47 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/10/07 10:31:47 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+static long	timeval_usec(const struct timeval *tv)
+{
+	return (tv->tv_sec * 1000000L + tv->tv_usec);
+}
+
+/**
+ * @brief Times of one stage: from its start to when it was reaped, and
+ * the CPU time wait4 reported for it
+ */
+void	stage_times(const t_stage *stage, t_times *times)
+{
+	times->real = stage_real_usec(stage);
+	times->user = timeval_usec(&stage->utime);
+	times->sys = timeval_usec(&stage->stime);
+}
+
+/**
+ * @brief Adds up the CPU time of the stages into total; its real time is
+ * left to the caller, as stages run side by side. NULL adds nothing.
+ */
+void	stages_times(const t_stages *stages, t_times *total)
+{
+	t_times	times;
+	size_t	i;
+
+	total->user = 0;
+	total->sys = 0;
+	i = 0;
+	while (stages && i < stages->count)
+	{
+		stage_times(&stages->items[i], &times);
+		total->user += times.user;
+		total->sys += times.sys;
+		i++;
+	}
+}
+
+/**
+ * @brief Appends usec as seconds, "0.250", or in the long form of
+ * TIMEFORMAT's %lR, "1m2.250s"; a negative precision is the default
+ */
+void	time_put(t_outbuf *out, long usec, int precision, int long_form)
+{
+	if (precision < 0)
+		precision = TIME_PRECISION_DEFAULT;
+	if (!long_form)
+	{
+		out_putseconds(out, usec, precision);
+		return ;
+	}
+	out_putnbr(out, usec / 60000000L);
+	out_putc(out, 'm');
+	out_putseconds(out, usec % 60000000L, precision);
+	out_putc(out, 's');
+}
+
+/**
+ * @brief Appends the CPU time as a percentage of the real time, "95.03"
+ * @details The percentage is put in hundredths of a "second" so that
+ * out_putseconds does the two decimals.
+ */
+void	time_put_percent(t_outbuf *out, const t_times *times)
+{
+	long	percent;
+
+	percent = 0;
+	if (times->real > 0)
+		percent = (times->user + times->sys) * 100000000L / times->real;
+	out_putseconds(out, percent, 2);
+}
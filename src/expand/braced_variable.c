@@ -12,56 +12,24 @@
 
 #include "minishell.h"
 
-static int	handle_no_closing_brace(t_expander *expander)
-{
-	expander->input_pos--;
-	if (expander_append_char(expander, '$'))
-		return (1);
-	if (expander_append_char(expander, '{'))
-		return (1);
-	return (0);
-}
-
-static int	extract_and_expand_var(t_expander *expander, size_t start,
-	size_t len, size_t i)
-{
-	char	*var_name;
-	char	*var_value;
-
-	var_name = ft_substr(expander->input, start, len);
-	if (!var_name)
-		return (1);
-	var_value = resolve_variable(var_name, expander->shell);
-	free(var_name);
-	if (var_value)
-	{
-		if (expander_append_string(expander, var_value))
-		{
-			free(var_value);
-			return (1);
-		}
-		free(var_value);
-	}
-	expander->input_pos = i + 1;
-	return (0);
-}
-
+/**
+ * @brief Expands ${name}; the read position is on the '{'
+ * @details Without a closing brace "${" is kept literally.
+ */
 int	handle_braced_var(t_expander *expander)
 {
-	size_t	start;
-	size_t	len;
-	size_t	i;
+	const char	*name;
+	const char	*close;
+	const char	*value;
 
 	expander->input_pos++;
-	start = expander->input_pos;
-	len = 0;
-	i = start;
-	while (expander->input[i] && expander->input[i] != '}')
-	{
-		len++;
-		i++;
-	}
-	if (!expander->input[i])
-		return (handle_no_closing_brace(expander));
-	return (extract_and_expand_var(expander, start, len, i));
+	name = expander->input + expander->input_pos;
+	close = memchr(name, '}', expander->input_len - expander->input_pos);
+	if (!close)
+		return (expander_append_span(expander, "${", 2));
+	expander->input_pos = close - expander->input + 1;
+	value = shell_var(expander->shell, name, close - name);
+	if (!value)
+		return (0);
+	return (expander_append_string(expander, value));
 }
@@ -12,29 +12,35 @@
 
 #include "minishell.h"
 
-void	expander_destroy(t_expander *expander)
+/**
+ * @brief Expands len bytes of input in the given quote state, appending to
+ * the result
+ * @details Literal runs up to the next byte the current quote state gives
+ * a meaning to are copied in one go; only that byte goes through
+ * expander_process_char. input need not be NUL-terminated.
+ * @return 0 on success, 1 on allocation failure
+ */
+int	expander_feed(t_expander *expander, const char *input, size_t len,
+		t_quote_state state)
 {
-	if (!expander)
-		return ;
-	if (expander->input)
-		free(expander->input);
-	if (expander->result)
-		free(expander->result);
-	free(expander);
-}
-
-int	expander_expand(t_expander *expander)
-{
-	char	c;
+	size_t	end;
 
-	if (!expander)
-		return (1);
-	while (expander->input[expander->input_pos])
+	expander->input = input;
+	expander->input_len = len;
+	expander->input_pos = 0;
+	expander->quote_state = state;
+	while (expander->input_pos < expander->input_len)
 	{
-		c = expander->input[expander->input_pos];
-		if (expander_process_char(expander, c))
+		end = expander_scan(expander->input, expander->input_pos,
+				expander->input_len, expander->quote_state);
+		if (expander_append_span(expander,
+				expander->input + expander->input_pos,
+				end - expander->input_pos))
+			return (1);
+		expander->input_pos = end;
+		if (end < expander->input_len
+			&& expander_process_char(expander, expander->input[end]))
 			return (1);
 	}
-	expander->result[expander->result_pos] = '\0';
 	return (0);
 }
@@ -44,8 +44,7 @@ int	handle_regular_char(t_expander *expander, char c)
 
 int	expander_process_char(t_expander *expander, char c)
 {
-	if (c == '\\' && (expander->quote_state == QUOTE_DOUBLE
-			|| expander->quote_state == QUOTE_NONE))
+	if (c == '\\' && expander->quote_state != QUOTE_SINGLE)
 		return (handle_backslash_escape(expander));
 	else if (c == '$' && should_expand_in_context(expander->quote_state))
 		return (expander_handle_variable(expander));
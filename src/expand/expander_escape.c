@@ -12,9 +12,14 @@
 
 #include "minishell.h"
 
+/**
+ * @brief Backslash in double quotes or a heredoc body: it only escapes
+ * '$', '\' and, in double quotes, '"'
+ */
 int	handle_double_quote_escape(t_expander *expander, char next_char)
 {
-	if (next_char == '$' || next_char == '"' || next_char == '\\')
+	if (next_char == '$' || next_char == '\\'
+		|| (next_char == '"' && expander->quote_state == QUOTE_DOUBLE))
 	{
 		if (expander_append_char(expander, next_char))
 			return (1);
@@ -55,10 +60,11 @@ int	handle_backslash_escape(t_expander *expander)
 	char	next_char;
 
 	expander->input_pos++;
-	if (expander->input_pos >= ft_strlen(expander->input))
+	if (expander->input_pos >= expander->input_len)
 		return (0);
 	next_char = expander->input[expander->input_pos];
-	if (expander->quote_state == QUOTE_DOUBLE)
+	if (expander->quote_state == QUOTE_DOUBLE
+		|| expander->quote_state == QUOTE_HEREDOC)
 		return (handle_double_quote_escape(expander, next_char));
 	else
 		return (handle_normal_escape(expander, next_char));
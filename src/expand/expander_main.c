@@ -12,63 +12,80 @@
 
 #include "minishell.h"
 
-char	*expand_string(const char *input, t_shell *shell, t_quote_state state)
+/**
+ * @brief Expands the first len bytes of input (need not be NUL-terminated)
+ * @return Newly allocated expanded string, or NULL on failure
+ */
+char	*expand_span(const char *input, size_t len, t_shell *shell,
+		t_quote_state state)
 {
-	t_expander	*expander;
+	t_expander	expander;
 	char		*result;
 
 	if (!input || !shell)
 		return (NULL);
-	expander = init_expander(input, shell, state);
-	if (!expander)
+	expander_begin(&expander, shell);
+	if (expander_feed(&expander, input, len, state)
+		|| expander_finish(&expander))
 		return (NULL);
-	if (expander_expand(expander))
-	{
-		expander_destroy(expander);
+	result = malloc(expander.result_pos + 1);
+	if (!result)
 		return (NULL);
-	}
-	result = ft_strdup(expander->result);
-	expander_destroy(expander);
+	memcpy(result, expander.result, expander.result_pos + 1);
 	return (result);
 }
 
-int	expand_token(t_token *token, t_shell *shell)
+char	*expand_string(const char *input, t_shell *shell, t_quote_state state)
+{
+	if (!input)
+		return (NULL);
+	return (expand_span(input, strlen(input), shell, state));
+}
+
+static int	expand_redirs(t_cmd *cmd, t_shell *shell)
 {
-	char	*expanded;
+	t_redir	*redir;
 
-	if (!token || !shell)
-		return (1);
-	if (token->type == TOKEN_WORD)
+	redir = cmd->redirs;
+	while (redir)
 	{
-		if (token->quote_state == QUOTE_SINGLE)
-			return (0);
-		expanded = expand_string(token->value, shell, token->quote_state);
-		if (!expanded)
+		redir->file = expand_word_if_needed(&shell->arena, redir->word,
+				redir->flags, shell);
+		if (!redir->file)
 			return (1);
-		free(token->value);
-		token->value = expanded;
+		redir = redir->next;
 	}
 	return (0);
 }
 
+/**
+ * @brief Expands a command's words and redirection targets into argv and
+ * file, both allocated in the per-line shell arena so that a cached plan
+ * does not grow each time it runs; words with nothing to expand are
+ * shared with the plan instead
+ * @return 0 on success, 1 on allocation failure
+ */
 int	expand_command(t_cmd *cmd, t_shell *shell)
 {
-	int		i;
-	char	*expanded;
+	size_t	i;
 
-	if (!cmd || !shell)
+	cmd->argv = NULL;
+	if (cmd->argc)
+		cmd->argv = arena_alloc(&shell->arena,
+				sizeof(char *) * (cmd->argc + 1));
+	if (cmd->argc && !cmd->argv)
 		return (1);
 	i = 0;
-	while (cmd->argv && cmd->argv[i])
+	while (i < cmd->argc)
 	{
-		expanded = expand_string(cmd->argv[i], shell, QUOTE_NONE);
-		if (!expanded)
+		cmd->argv[i] = expand_word_if_needed(&shell->arena, cmd->words[i],
+				cmd->word_flags[i], shell);
+		if (!cmd->argv[i++])
 			return (1);
-		free(cmd->argv[i]);
-		cmd->argv[i] = expanded;
-		i++;
 	}
-	return (0);
+	if (cmd->argv)
+		cmd->argv[i] = NULL;
+	return (expand_redirs(cmd, shell));
 }
 
 int	expand_command_list(t_cmd *cmd_list, t_shell *shell)
@@ -12,62 +12,64 @@
 
 #include "minishell.h"
 
-static int	expander_alloc_result(t_expander *expander, const char *input)
+/**
+ * @brief Starts an expansion into the shell's scratch buffer
+ */
+void	expander_begin(t_expander *expander, t_shell *shell)
 {
-	expander->result_capacity = ft_strlen(input) * 2;
-	expander->result = malloc(expander->result_capacity + 1);
-	if (!expander->result)
-	{
-		free(expander->input);
-		free(expander);
+	ft_bzero(expander, sizeof(t_expander));
+	expander->shell = shell;
+	expander->result = shell->expand_buf;
+	expander->result_capacity = shell->expand_cap;
+	expander->flush_fd = -1;
+}
+
+/**
+ * @brief Turns the expander into a stream writing to fd in blocks of
+ * EXPAND_STREAM_BLOCK bytes; expander_flush writes the last one
+ * @return 0 on success, 1 on allocation failure
+ */
+int	expander_stream(t_expander *expander, int fd)
+{
+	if (expander_reserve(expander, EXPAND_STREAM_BLOCK))
 		return (1);
-	}
-	expander->result[0] = '\0';
+	expander->flush_fd = fd;
 	return (0);
 }
 
-t_expander	*init_expander(const char *input, t_shell *shell,
-		t_quote_state state)
+/**
+ * @brief Writes out and empties the result of a streaming expander
+ * @return 0 on success, 1 on write error
+ */
+int	expander_flush(t_expander *expander)
 {
-	t_expander	*expander;
-
-	if (!input || !shell)
-		return (NULL);
-	expander = ft_calloc(1, sizeof(t_expander));
-	if (!expander)
-		return (NULL);
-	expander->input = ft_strdup(input);
-	if (!expander->input)
-	{
-		free(expander);
-		return (NULL);
-	}
-	if (expander_alloc_result(expander, input))
-		return (NULL);
-	expander->input_pos = 0;
+	if (expander->flush_fd < 0 || !expander->result_pos)
+		return (0);
+	if (write_full(expander->flush_fd, expander->result,
+			expander->result_pos) == -1)
+		return (1);
 	expander->result_pos = 0;
-	expander->quote_state = state;
-	expander->shell = shell;
-	expander->error = 0;
-	return (expander);
+	return (0);
 }
 
-void	expander_set_error(t_expander *expander)
+/**
+ * @brief Terminates the result
+ * @return 0 on success, 1 on allocation failure
+ */
+int	expander_finish(t_expander *expander)
 {
-	if (expander)
-		expander->error = 1;
+	if (expander_reserve(expander, 1))
+		return (1);
+	expander->result[expander->result_pos] = '\0';
+	return (0);
 }
 
-char	*var_name_alloc(const char *input, size_t start, size_t len)
+/**
+ * @brief Returns the byte at the read position, or '\0' past the span
+ */
+char	expander_peek(t_expander *expander)
 {
-	char	*var_name;
-
-	if (!input || len == 0)
-		return (NULL);
-	var_name = malloc(len + 1);
-	if (!var_name)
-		return (NULL);
-	ft_memcpy(var_name, input + start, len);
-	var_name[len] = '\0';
-	return (var_name);
+	if (expander->input_pos >= expander->input_len)
+		return ('\0');
+	return (expander->input[expander->input_pos]);
 }
@@ -0,0 +1,97 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   expander_scan.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/25 10:12:07 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/09/25 10:12:07 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "minishell.h"
+
+static size_t	scan_scalar(const char *s, size_t pos, size_t len)
+{
+	while (pos < len && s[pos] != '$' && s[pos] != '\\'
+		&& s[pos] != '\'' && s[pos] != '"')
+		pos++;
+	return (pos);
+}
+
+#if LEXER_SIMD_X86
+
+# include <immintrin.h>
+
+static size_t	scan_vector(const char *s, size_t pos, size_t len)
+{
+	__m128i	v;
+	__m128i	m;
+	int		mask;
+
+	while (pos + 16 <= len)
+	{
+		v = _mm_loadu_si128((const __m128i *)(s + pos));
+		m = _mm_cmpeq_epi8(v, _mm_set1_epi8('$'));
+		m = _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_set1_epi8('\\')));
+		m = _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_set1_epi8('\'')));
+		m = _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_set1_epi8('"')));
+		mask = _mm_movemask_epi8(m);
+		if (mask)
+			return (pos + __builtin_ctz(mask));
+		pos += 16;
+	}
+	return (scan_scalar(s, pos, len));
+}
+
+#else
+
+static size_t	scan_vector(const char *s, size_t pos, size_t len)
+{
+	return (scan_scalar(s, pos, len));
+}
+
+#endif
+
+/**
+ * @brief In a heredoc body only '$' and '\' mean anything
+ */
+static size_t	scan_heredoc(const char *s, size_t pos, size_t len)
+{
+	const char	*dollar;
+	const char	*backslash;
+
+	dollar = memchr(s + pos, '$', len - pos);
+	if (dollar)
+		len = dollar - s;
+	backslash = memchr(s + pos, '\\', len - pos);
+	if (backslash)
+		return (backslash - s);
+	return (len);
+}
+
+/**
+ * @brief Finds the end of the literal run starting at pos
+ * @details Inside single quotes only the closing quote matters, in a
+ * heredoc body '$' and '\'; elsewhere '$', '\' and both quotes do. SSE2
+ * checks 16 bytes per step.
+ * @return Index of the first byte needing interpretation, or len
+ */
+size_t	expander_scan(const char *s, size_t pos, size_t len,
+		t_quote_state state)
+{
+	const char	*quote;
+
+	if (state == QUOTE_HEREDOC)
+		return (scan_heredoc(s, pos, len));
+	if (state == QUOTE_SINGLE)
+	{
+		quote = memchr(s + pos, '\'', len - pos);
+		if (!quote)
+			return (len);
+		return (quote - s);
+	}
+	return (scan_vector(s, pos, len));
+}
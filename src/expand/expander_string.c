@@ -12,50 +12,63 @@
 
 #include "minishell.h"
 
-int	expander_append_char(t_expander *expander, char c)
-{
-	if (!expander)
-		return (1);
-	if (expander->result_pos >= expander->result_capacity)
-	{
-		if (expander_resize_result(expander))
-			return (1);
-	}
-	expander->result[expander->result_pos] = c;
-	expander->result_pos++;
-	return (0);
-}
-
-int	expander_append_string(t_expander *expander, const char *str)
-{
-	size_t	i;
-
-	if (!expander || !str)
-		return (1);
-	i = 0;
-	while (str[i])
-	{
-		if (expander_append_char(expander, str[i]))
-			return (1);
-		i++;
-	}
-	return (0);
-}
-
-int	expander_resize_result(t_expander *expander)
+/**
+ * @brief Makes room for extra more bytes plus the terminator, doubling the
+ * buffer so appends stay amortised O(1); the shell keeps the buffer for
+ * the next expansion
+ * @details A streaming expander writes its buffer out first, and only
+ * grows it for a single append larger than the buffer.
+ * @return 0 on success, 1 on allocation or write failure
+ */
+int	expander_reserve(t_expander *expander, size_t extra)
 {
 	char	*new_result;
 	size_t	new_capacity;
 
-	if (!expander)
+	if (expander->result_pos + extra <= expander->result_capacity)
+		return (0);
+	if (expander->flush_fd >= 0 && expander_flush(expander))
 		return (1);
+	if (expander->result_pos + extra <= expander->result_capacity)
+		return (0);
 	new_capacity = expander->result_capacity * 2;
+	if (new_capacity < expander->result_pos + extra)
+		new_capacity = expander->result_pos + extra;
 	new_result = malloc(new_capacity + 1);
 	if (!new_result)
 		return (1);
-	ft_memcpy(new_result, expander->result, expander->result_pos);
+	memcpy(new_result, expander->result, expander->result_pos);
 	free(expander->result);
 	expander->result = new_result;
 	expander->result_capacity = new_capacity;
+	expander->shell->expand_buf = new_result;
+	expander->shell->expand_cap = new_capacity;
 	return (0);
 }
+
+int	expander_append_char(t_expander *expander, char c)
+{
+	if (!expander || expander_reserve(expander, 1))
+		return (1);
+	expander->result[expander->result_pos++] = c;
+	return (0);
+}
+
+/**
+ * @brief Appends len bytes of str with a single copy
+ */
+int	expander_append_span(t_expander *expander, const char *str, size_t len)
+{
+	if (!expander || !str || expander_reserve(expander, len))
+		return (1);
+	memcpy(expander->result + expander->result_pos, str, len);
+	expander->result_pos += len;
+	return (0);
+}
+
+int	expander_append_string(t_expander *expander, const char *str)
+{
+	if (!str)
+		return (1);
+	return (expander_append_span(expander, str, strlen(str)));
+}
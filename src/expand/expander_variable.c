@@ -12,66 +12,58 @@
 
 #include "minishell.h"
 
-static int	expander_handle_exit_status(t_expander *expander)
-{
-	char	*var_value;
-
-	expander->input_pos++;
-	var_value = resolve_exit_status(expander->shell);
-	if (var_value)
-	{
-		if (expander_append_string(expander, var_value))
-		{
-			free(var_value);
-			return (1);
-		}
-		free(var_value);
-	}
-	return (0);
-}
-
-int	handle_braced_var(t_expander *expander);
-
 static int	handle_regular_var(t_expander *expander)
 {
-	char	*var_name;
-	char	*var_value;
+	const char	*value;
+	size_t		start;
 
-	var_name = parse_variable_name(expander->input, &expander->input_pos);
-	if (!var_name)
-	{
-		if (expander_append_char(expander, '$'))
-			return (1);
+	start = expander->input_pos;
+	while (expander->input_pos < expander->input_len
+		&& is_valid_var_char(expander->input[expander->input_pos]))
+		expander->input_pos++;
+	if (expander->input_pos == start)
+		return (expander_append_char(expander, '$'));
+	value = shell_var(expander->shell, expander->input + start,
+			expander->input_pos - start);
+	if (!value)
 		return (0);
-	}
-	var_value = resolve_variable(var_name, expander->shell);
-	free(var_name);
-	if (var_value)
-	{
-		if (expander_append_string(expander, var_value))
-		{
-			free(var_value);
-			return (1);
-		}
-		free(var_value);
-	}
-	return (0);
+	return (expander_append_string(expander, value));
 }
 
-static int	expander_handle_env_var(t_expander *expander)
+static int	handle_positional_var(t_expander *expander)
 {
-	if (expander->input[expander->input_pos] == '{')
-		return (handle_braced_var(expander));
-	return (handle_regular_var(expander));
+	const char	*value;
+
+	value = shell_positional(expander->shell,
+			expander->input + expander->input_pos, 1);
+	expander->input_pos++;
+	if (!value)
+		return (0);
+	return (expander_append_string(expander, value));
 }
 
+/**
+ * @brief Expands the reference whose '$' is at the read position
+ * @details Names are looked up in place and values appended from the
+ * environment without being copied first.
+ */
 int	expander_handle_variable(t_expander *expander)
 {
+	char	c;
+
 	if (!expander)
 		return (1);
 	expander->input_pos++;
-	if (expander->input[expander->input_pos] == '?')
-		return (expander_handle_exit_status(expander));
-	else
-		return (expander_handle_env_var(expander));
+	c = expander_peek(expander);
+	if (c == '?')
+	{
+		expander->input_pos++;
+		return (expander_append_string(expander,
+				shell_status_str(expander->shell)));
+	}
+	if (c == '{')
+		return (handle_braced_var(expander));
+	if (is_positional_param(c))
+		return (handle_positional_var(expander));
+	return (handle_regular_var(expander));
 }
@@ -0,0 +1,113 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   expander_word.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/23 11:02:15 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/09/23 11:02:15 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "minishell.h"
+
+/**
+ * @brief Expands the quoted or unquoted segment of raw starting at *pos
+ * @details Segments follow the lexer's tokens: '...' is copied verbatim,
+ * "..." and bare text are expanded in their quote context.
+ */
+static int	expand_segment(t_expander *expander, const char *raw, size_t *pos)
+{
+	const char	*close;
+	size_t		start;
+
+	start = *pos;
+	if (!is_quote(raw[start]))
+	{
+		while (raw[*pos] && !is_quote(raw[*pos]))
+			(*pos)++;
+		return (expander_feed(expander, raw + start, *pos - start,
+				QUOTE_NONE));
+	}
+	close = ft_strchr(raw + start + 1, raw[start]);
+	if (!close)
+		close = raw + ft_strlen(raw);
+	*pos = close - raw + (*close != '\0');
+	if (raw[start] == '\'')
+		return (expander_append_span(expander, raw + start + 1,
+				close - raw - start - 1));
+	return (expander_feed(expander, raw + start + 1,
+			close - raw - start - 1, QUOTE_DOUBLE));
+}
+
+/**
+ * @brief Expands a word as written on the command line into the shell's
+ * scratch buffer
+ * @details Run at execution time, so $? and variables exported earlier
+ * in the same command list are seen.
+ */
+static int	expand_word_scratch(t_expander *expander, const char *raw,
+		t_shell *shell)
+{
+	size_t	pos;
+
+	expander_begin(expander, shell);
+	pos = 0;
+	while (raw[pos])
+	{
+		if (expand_segment(expander, raw, &pos))
+			return (1);
+	}
+	return (expander_finish(expander));
+}
+
+/**
+ * @return Newly allocated expansion of raw, or NULL on failure
+ */
+char	*expand_word(const char *raw, t_shell *shell)
+{
+	t_expander	expander;
+	char		*result;
+
+	if (expand_word_scratch(&expander, raw, shell))
+		return (NULL);
+	result = malloc(expander.result_pos + 1);
+	if (!result)
+		return (NULL);
+	memcpy(result, expander.result, expander.result_pos + 1);
+	return (result);
+}
+
+/**
+ * @brief expand_word, with the result copied into arena
+ * @details Once the scratch buffer and the arena are warm this makes no
+ * heap allocation at all.
+ */
+char	*expand_word_in(t_arena *arena, const char *raw, t_shell *shell)
+{
+	t_expander	expander;
+
+	if (expand_word_scratch(&expander, raw, shell))
+		return (NULL);
+	return (arena_strndup(arena, expander.result, expander.result_pos));
+}
+
+/**
+ * @brief expand_word_in, skipped for words the lexer found nothing to
+ * expand in
+ * @details Such a word is returned as is, without copying it; it lives in
+ * the plan arena, which outlives the line.
+ */
+char	*expand_word_if_needed(t_arena *arena, char *raw, int flags,
+		t_shell *shell)
+{
+	if (!flags)
+	{
+		shell->words_bypassed++;
+		return (raw);
+	}
+	shell->words_expanded++;
+	return (expand_word_in(arena, raw, shell));
+}
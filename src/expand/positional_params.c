@@ -0,0 +1,91 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   positional_params.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/10/08 14:20:37 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/10/08 14:20:37 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+static const char	*positional_at(t_shell *shell, const char *name,
+		size_t len)
+{
+	size_t	i;
+	long	index;
+
+	index = 0;
+	i = 0;
+	while (i < len)
+	{
+		if (!ft_isdigit(name[i]))
+			return (NULL);
+		if (index < shell->pos_count)
+			index = index * 10 + name[i] - '0';
+		i++;
+	}
+	if (index >= shell->pos_count)
+		return (NULL);
+	return (shell->pos_args[index]);
+}
+
+static const char	*positional_joined(t_shell *shell)
+{
+	size_t	len;
+	int		i;
+
+	if (shell->pos_joined)
+		return (shell->pos_joined);
+	len = 0;
+	i = 1;
+	while (i < shell->pos_count)
+		len += ft_strlen(shell->pos_args[i++]) + 1;
+	shell->pos_joined = malloc(len + 1);
+	if (!shell->pos_joined)
+		return (NULL);
+	len = 0;
+	i = 1;
+	while (i < shell->pos_count)
+	{
+		if (i > 1)
+			shell->pos_joined[len++] = ' ';
+		ft_memcpy(shell->pos_joined + len, shell->pos_args[i],
+			ft_strlen(shell->pos_args[i]));
+		len += ft_strlen(shell->pos_args[i++]);
+	}
+	shell->pos_joined[len] = '\0';
+	return (shell->pos_joined);
+}
+
+/**
+ * @brief Whether c starts a positional or special parameter: a digit, '#',
+ * '@' or '*'
+ */
+int	is_positional_param(char c)
+{
+	return (ft_isdigit(c) || c == '#' || c == '@' || c == '*');
+}
+
+/**
+ * @brief Resolves $N, ${N}, $#, $@ and $*
+ * @details With no field splitting, $@ and $* are both the arguments from
+ * $1 on joined by single spaces. The joined text and the $# text are built
+ * on first use; the arguments never change afterwards.
+ * @return Borrowed value, or NULL when unset
+ */
+const char	*shell_positional(t_shell *shell, const char *name, size_t len)
+{
+	if (len == 1 && (name[0] == '@' || name[0] == '*'))
+		return (positional_joined(shell));
+	if (len == 1 && name[0] == '#')
+	{
+		if (!shell->pos_count_text)
+			shell->pos_count_text = ft_itoa(shell->pos_count - 1);
+		return (shell->pos_count_text);
+	}
+	return (positional_at(shell, name, len));
+}
@@ -12,67 +12,64 @@
 
 #include "minishell.h"
 
-char	*resolve_variable(const char *var_name, t_shell *shell)
+static void	format_status(char *buf, int status)
 {
-	if (!var_name || !shell)
-		return (NULL);
-	if (ft_strcmp((char *)var_name, "?") == 0)
-		return (resolve_exit_status(shell));
-	return (get_env_var(var_name, shell));
-}
-
-char	*resolve_exit_status(t_shell *shell)
-{
-	char	*status_str;
+	char			digits[12];
+	unsigned int	n;
+	size_t			len;
+	size_t			i;
 
-	if (!shell)
-		return (NULL);
-	status_str = ft_itoa(shell->last_status);
-	return (status_str);
+	n = (unsigned int)status;
+	if (status < 0)
+		n = -(unsigned int)status;
+	len = 0;
+	digits[len++] = '0' + n % 10;
+	while (n >= 10)
+	{
+		n /= 10;
+		digits[len++] = '0' + n % 10;
+	}
+	i = 0;
+	if (status < 0)
+		buf[i++] = '-';
+	while (len)
+		buf[i++] = digits[--len];
+	buf[i] = '\0';
 }
 
-char	*get_env_var(const char *name, t_shell *shell)
+/**
+ * @brief Returns $? as text, reformatted only when last_status changed
+ */
+const char	*shell_status_str(t_shell *shell)
 {
-	char	*value;
-	size_t	name_len;
-	size_t	i;
-
-	if (!name || !shell || !shell->envp)
-		return (NULL);
-	name_len = ft_strlen(name);
-	i = 0;
-	while (shell->envp[i])
+	if (!shell->status_text[0] || shell->status_cached != shell->last_status)
 	{
-		if (ft_strncmp(shell->envp[i], name, name_len) == 0
-			&& shell->envp[i][name_len] == '=')
-		{
-			value = ft_strdup(shell->envp[i] + name_len + 1);
-			return (value);
-		}
-		i++;
+		format_status(shell->status_text, shell->last_status);
+		shell->status_cached = shell->last_status;
 	}
-	return (ft_strdup(""));
+	return (shell->status_text);
 }
 
-char	*parse_variable_name(const char *input, size_t *pos)
+/**
+ * @brief Looks up the variable named by len bytes at name, "?", PIPESTATUS
+ * and the positional parameters included
+ * @return Borrowed value, valid until the variable changes, or NULL when
+ * unset
+ */
+const char	*shell_var(t_shell *shell, const char *name, size_t len)
 {
-	size_t	start;
-	size_t	len;
-	char	*var_name;
+	t_env_var	*var;
 
-	if (!input || !pos)
-		return (NULL);
-	start = *pos;
-	len = 0;
-	while (input[start + len] && is_valid_var_char(input[start + len]))
-		len++;
-	if (len == 0)
-		return (NULL);
-	var_name = var_name_alloc(input, start, len);
-	if (!var_name)
+	if (len == 1 && name[0] == '?')
+		return (shell_status_str(shell));
+	if (len == 10 && ft_strncmp(name, "PIPESTATUS", 10) == 0)
+		return (stages_status_str(&shell->last_stages));
+	if (len && is_positional_param(name[0]))
+		return (shell_positional(shell, name, len));
+	var = env_find(&shell->env, name, len);
+	if (!var)
 		return (NULL);
-	*pos += len;
-	return (var_name);
+	return (var->entry + var->name_len + 1);
 }
 
 int	is_valid_var_char(char c)
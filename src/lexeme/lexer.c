@@ -13,6 +13,11 @@
 #include "tokens.h"
 #include "minishell.h"
 
+/**
+ * @brief Creates a lexer over a borrowed input line
+ * @details The input is not copied: tokens are spans into it, so the caller
+ * must keep the line alive until lexer_destroy.
+ */
 t_lexer	*lexer_init(const char *input)
 {
 	t_lexer	*lexer;
@@ -22,23 +27,21 @@ t_lexer	*lexer_init(const char *input)
 	lexer = ft_calloc(1, sizeof(t_lexer));
 	if (!lexer)
 		return (NULL);
-	lexer->input = ft_strdup(input);
-	if (!lexer->input)
-	{
-		free(lexer);
-		return (NULL);
-	}
+	lexer->input = input;
 	lexer->pos = 0;
-	lexer->len = ft_strlen(lexer->input);
+	lexer->len = ft_strlen(input);
+	lexer->chunks = NULL;
 	return (lexer);
 }
 
+/**
+ * @brief Destroys the lexer and every token it produced in one step
+ */
 void	lexer_destroy(t_lexer *lexer)
 {
 	if (lexer)
 	{
-		if (lexer->input)
-			free((char *)lexer->input);
+		token_arena_release(lexer);
 		free(lexer);
 	}
 }
@@ -13,17 +13,36 @@
 #include "tokens.h"
 #include "minishell.h"
 
+/**
+ * @brief Returns the 256-entry character class table used by the lexer
+ * @details Built at compile time. Any byte with a non-zero class stops
+ * lexer_scan; the SIMD scanners match exactly the same byte set.
+ */
+const unsigned char	*lexer_char_class(void)
+{
+	static const unsigned char	table[256] = {
+	['\t'] = CC_SPACE, ['\n'] = CC_SPACE, ['\r'] = CC_SPACE,
+	[' '] = CC_SPACE,
+	['|'] = CC_META, ['<'] = CC_META, ['>'] = CC_META,
+	[';'] = CC_META, ['&'] = CC_META,
+	['\''] = CC_QUOTE, ['"'] = CC_QUOTE,
+	['$'] = CC_DOLLAR
+	};
+
+	return (table);
+}
+
 int	is_whitespace(char c)
 {
-	return (c == ' ' || c == '\t' || c == '\n' || c == '\r');
+	return (lexer_char_class()[(unsigned char)c] == CC_SPACE);
 }
 
 int	is_metacharacter(char c)
 {
-	return (c == '|' || c == '<' || c == '>');
+	return (lexer_char_class()[(unsigned char)c] == CC_META);
 }
 
 int	is_quote(char c)
 {
-	return (c == '\'' || c == '"');
+	return (lexer_char_class()[(unsigned char)c] == CC_QUOTE);
 }
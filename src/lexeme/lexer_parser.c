@@ -12,80 +12,62 @@
 
 #include "minishell.h"
 
-static t_token	*handle_redir_in(t_lexer *lexer)
-{
-	lexer->pos++;
-	if (lexer->pos < lexer->len && lexer->input[lexer->pos] == '<')
-	{
-		lexer->pos++;
-		return (create_token(TOKEN_HEREDOC, "<<", 2));
-	}
-	return (create_token(TOKEN_REDIR_IN, "<", 1));
-}
-
-static t_token	*handle_redir_out(t_lexer *lexer)
-{
-	lexer->pos++;
-	if (lexer->pos < lexer->len && lexer->input[lexer->pos] == '>')
-	{
-		lexer->pos++;
-		return (create_token(TOKEN_REDIR_APPEND, ">>", 2));
-	}
-	return (create_token(TOKEN_REDIR_OUT, ">", 1));
-}
-
 static t_token	*handle_quoted_word(t_lexer *lexer, char c)
 {
-	char			*value;
-	t_token			*token;
-	t_quote_state	quote_state;
+	t_token	*token;
+	size_t	start;
 
-	value = lexer_read_quoted(lexer, c);
-	if (!value)
-		return (create_token(TOKEN_ERROR, NULL, 0));
+	start = lexer->pos + 1;
+	if (!lexer_read_quoted(lexer, c))
+		return (create_token(lexer, TOKEN_ERROR, start - 1, 0));
+	token = create_token(lexer, TOKEN_WORD, start, lexer->pos - start - 1);
+	if (!token)
+		return (NULL);
+	token->flags = TOKEN_HAS_QUOTE;
 	if (c == '\'')
-		quote_state = QUOTE_SINGLE;
+		token->quote_state = QUOTE_SINGLE;
 	else
-		quote_state = QUOTE_DOUBLE;
-	token = create_quoted_token(TOKEN_WORD, value, ft_strlen(value),
-			quote_state);
-	free(value);
+		token->quote_state = QUOTE_DOUBLE;
 	return (token);
 }
 
 static t_token	*handle_unquoted_word(t_lexer *lexer)
 {
-	char	*value;
 	t_token	*token;
+	size_t	start;
+	size_t	length;
+	int		flags;
 
-	value = lexer_read_word(lexer);
-	if (!value)
-		return (create_token(TOKEN_ERROR, NULL, 0));
-	token = create_token(TOKEN_WORD, value, ft_strlen(value));
-	free(value);
+	start = lexer->pos;
+	flags = 0;
+	length = lexer_read_word(lexer, &flags);
+	token = create_token(lexer, TOKEN_WORD, start, length);
+	if (token)
+		token->flags = flags;
 	return (token);
 }
 
+/**
+ * @brief Returns the next token of the input
+ * @details Tokens are spans into the input allocated from the lexer arena;
+ * no characters are copied.
+ */
 t_token	*lexer_next_token(t_lexer *lexer)
 {
 	char	c;
 
-	if (!lexer || lexer->pos >= lexer->len)
-		return (create_token(TOKEN_EOF, NULL, 0));
+	if (!lexer)
+		return (NULL);
 	while (lexer->pos < lexer->len && is_whitespace(lexer->input[lexer->pos]))
 		lexer->pos++;
 	if (lexer->pos >= lexer->len)
-		return (create_token(TOKEN_EOF, NULL, 0));
+		return (create_token(lexer, TOKEN_EOF, lexer->len, 0));
 	c = lexer->input[lexer->pos];
-	if (c == '|')
-	{
-		lexer->pos++;
-		return (create_token(TOKEN_PIPE, "|", 1));
-	}
-	else if (c == '<')
-		return (handle_redir_in(lexer));
-	else if (c == '>')
-		return (handle_redir_out(lexer));
+	if (c == '|' || c == ';' || (c == '&' && lexer->pos + 1 < lexer->len
+			&& lexer->input[lexer->pos + 1] == '&'))
+		return (lexer_read_operator(lexer));
+	else if (lexer_at_redir(lexer))
+		return (lexer_read_redir(lexer));
 	else if (is_quote(c))
 		return (handle_quoted_word(lexer, c));
 	else
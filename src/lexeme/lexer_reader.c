@@ -13,35 +13,65 @@
 #include "tokens.h"
 #include "minishell.h"
 
-char	*lexer_read_word(t_lexer *lexer)
+/**
+ * @brief Whether the classified byte at pos belongs to the current word
+ * @details '$' always does, and so do a backslash-escaped ';' or '&' and an
+ * '&' that does not start "&&" or "&>".
+ */
+static int	word_continues(t_lexer *lexer)
+{
+	char	c;
+
+	c = lexer->input[lexer->pos];
+	if (c == '$')
+		return (1);
+	if ((c == ';' || c == '&') && lexer->pos > 0
+		&& lexer->input[lexer->pos - 1] == '\\')
+		return (1);
+	return (c == '&' && (lexer->pos + 1 >= lexer->len
+			|| (lexer->input[lexer->pos + 1] != '&'
+				&& lexer->input[lexer->pos + 1] != '>')));
+}
+
+/**
+ * @brief Advances over an unquoted word
+ * @details Jumps from delimiter to delimiter with lexer_scan, stepping
+ * over the classified bytes that do not end a word. Sets TOKEN_HAS_DOLLAR
+ * and TOKEN_HAS_BACKSLASH in flags when the word holds those bytes.
+ * @return Length of the word
+ */
+size_t	lexer_read_word(t_lexer *lexer, int *flags)
 {
 	size_t	start;
-	size_t	len;
 
 	start = lexer->pos;
-	while (lexer->pos < lexer->len
-		&& !is_whitespace(lexer->input[lexer->pos])
-		&& !is_metacharacter(lexer->input[lexer->pos])
-		&& !is_quote(lexer->input[lexer->pos]))
+	lexer->pos = lexer_scan(lexer->input, lexer->pos, lexer->len);
+	while (lexer->pos < lexer->len && word_continues(lexer))
 	{
-		lexer->pos++;
+		if (lexer->input[lexer->pos] == '$')
+			*flags |= TOKEN_HAS_DOLLAR;
+		lexer->pos = lexer_scan(lexer->input, lexer->pos + 1, lexer->len);
 	}
-	len = lexer->pos - start;
-	return (ft_substr(lexer->input, start, len));
+	if (memchr(lexer->input + start, '\\', lexer->pos - start))
+		*flags |= TOKEN_HAS_BACKSLASH;
+	return (lexer->pos - start);
 }
 
-char	*lexer_read_quoted(t_lexer *lexer, char quote)
+/**
+ * @brief Advances over a quoted word, including both quote characters
+ * @return 1 on success, 0 if the closing quote is missing
+ */
+int	lexer_read_quoted(t_lexer *lexer, char quote)
 {
-	size_t	start;
-	size_t	len;
+	const char	*close;
 
 	lexer->pos++;
-	start = lexer->pos;
-	while (lexer->pos < lexer->len && lexer->input[lexer->pos] != quote)
-		lexer->pos++;
-	if (lexer->pos >= lexer->len)
-		return (NULL);
-	len = lexer->pos - start;
-	lexer->pos++;
-	return (ft_substr(lexer->input, start, len));
+	close = memchr(lexer->input + lexer->pos, quote, lexer->len - lexer->pos);
+	if (!close)
+	{
+		lexer->pos = lexer->len;
+		return (0);
+	}
+	lexer->pos = close - lexer->input + 1;
+	return (1);
 }
@@ -0,0 +1,127 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   lexer_redir.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/10/01 10:12:44 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/10/01 10:12:44 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "tokens.h"
+#include "minishell.h"
+
+/**
+ * @brief Whether a number at pos may name the fd of a redirection
+ * @details Only a number that is a whole word does: "echo a2>f" and
+ * "echo \"a\"2>f" redirect stdout of a word ending in 2.
+ */
+static int	io_number_allowed(t_lexer *lexer)
+{
+	char	prev;
+
+	if (lexer->pos == 0)
+		return (1);
+	prev = lexer->input[lexer->pos - 1];
+	return (is_whitespace(prev) || prev == '|' || prev == ';' || prev == '&');
+}
+
+/**
+ * @brief Reads the digits at *pos into *value and moves *pos past them
+ * @return 1, or 0 when the number does not fit in an int
+ */
+static int	read_io_number(t_lexer *lexer, size_t *pos, int *value)
+{
+	int	digit;
+	int	fits;
+
+	*value = 0;
+	fits = 1;
+	while (*pos < lexer->len && ft_isdigit(lexer->input[*pos]))
+	{
+		digit = lexer->input[(*pos)++] - '0';
+		if (*value > (INT_MAX - digit) / 10)
+			fits = 0;
+		if (fits)
+			*value = *value * 10 + digit;
+	}
+	return (fits);
+}
+
+/**
+ * @brief Whether a redirection starts at pos: "<", ">", "&>" or one of
+ * them preceded by an fd number
+ * @details A number too large for an int is no fd number: it is read as
+ * a word and the operator after it redirects the default fd, as in bash.
+ */
+int	lexer_at_redir(t_lexer *lexer)
+{
+	size_t	pos;
+	int		io_fd;
+
+	pos = lexer->pos;
+	if (lexer->input[pos] == '&')
+		return (pos + 1 < lexer->len && lexer->input[pos + 1] == '>');
+	if (ft_isdigit(lexer->input[pos]) && io_number_allowed(lexer)
+		&& !read_io_number(lexer, &pos, &io_fd))
+		return (0);
+	return (pos < lexer->len
+		&& (lexer->input[pos] == '<' || lexer->input[pos] == '>'));
+}
+
+/**
+ * @brief Reads "<", "<<", "<&", ">", ">>" or ">&" at pos into a token
+ * that starts at start
+ */
+static t_token	*read_redir_op(t_lexer *lexer, size_t start)
+{
+	char			c;
+	t_token_type	type;
+
+	c = lexer->input[lexer->pos++];
+	type = TOKEN_REDIR_IN;
+	if (c == '>')
+		type = TOKEN_REDIR_OUT;
+	if (lexer->pos < lexer->len && lexer->input[lexer->pos] == c)
+	{
+		type = TOKEN_HEREDOC;
+		if (c == '>')
+			type = TOKEN_REDIR_APPEND;
+	}
+	else if (lexer->pos < lexer->len && lexer->input[lexer->pos] == '&')
+	{
+		type = TOKEN_DUP_IN;
+		if (c == '>')
+			type = TOKEN_DUP_OUT;
+	}
+	if (type != TOKEN_REDIR_IN && type != TOKEN_REDIR_OUT)
+		lexer->pos++;
+	return (create_token(lexer, type, start, lexer->pos - start));
+}
+
+/**
+ * @brief Reads the redirection lexer_at_redir found
+ * @details The token spans the fd number too; io_fd keeps its value, or
+ * -1 when there is none.
+ */
+t_token	*lexer_read_redir(t_lexer *lexer)
+{
+	size_t	start;
+	int		io_fd;
+	t_token	*token;
+
+	start = lexer->pos;
+	if (lexer->input[start] == '&')
+	{
+		lexer->pos += 2;
+		return (create_token(lexer, TOKEN_REDIR_ALL, start, 2));
+	}
+	io_fd = -1;
+	if (ft_isdigit(lexer->input[start]))
+		read_io_number(lexer, &lexer->pos, &io_fd);
+	token = read_redir_op(lexer, start);
+	if (token)
+		token->io_fd = io_fd;
+	return (token);
+}
@@ -0,0 +1,51 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   lexer_scan.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/20 10:14:05 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/09/20 10:14:05 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "tokens.h"
+#include "minishell.h"
+
+size_t	lexer_scan_scalar(const char *s, size_t pos, size_t len)
+{
+	const unsigned char	*cls;
+
+	cls = lexer_char_class();
+	while (pos < len && !cls[(unsigned char)s[pos]])
+		pos++;
+	return (pos);
+}
+
+/**
+ * @brief Jumps to the next whitespace, metacharacter, quote or '$'
+ * @details Dispatches once, at first use, to the AVX2, SSE2 or scalar
+ * scanner, so long words are skipped 16-32 bytes at a time.
+ * @return Index of the delimiter in s[pos, len), or len if there is none
+ */
+size_t	lexer_scan(const char *s, size_t pos, size_t len)
+{
+	static t_scan_fn	scan;
+
+	if (!scan)
+		scan = lexer_scan_best();
+	return (scan(s, pos, len));
+}
+
+const char	*lexer_scan_name(void)
+{
+	t_scan_fn	scan;
+
+	scan = lexer_scan_best();
+	if (scan == lexer_scan_avx2)
+		return ("avx2");
+	if (scan == lexer_scan_sse2)
+		return ("sse2");
+	return ("scalar");
+}
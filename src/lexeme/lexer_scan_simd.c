@@ -0,0 +1,119 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   lexer_scan_simd.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/20 10:14:05 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/09/20 10:14:05 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "tokens.h"
+#include "minishell.h"
+
+#if LEXER_SIMD_X86
+
+# include <immintrin.h>
+
+/* Keep in sync with the non-zero entries of lexer_char_class() */
+static int	sse2_class_mask(__m128i v)
+{
+	__m128i	m;
+
+	m = _mm_cmpeq_epi8(v, _mm_set1_epi8(' '));
+	m = _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_set1_epi8('\t')));
+	m = _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_set1_epi8('\n')));
+	m = _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_set1_epi8('\r')));
+	m = _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_set1_epi8('|')));
+	m = _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_set1_epi8('<')));
+	m = _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_set1_epi8('>')));
+	m = _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_set1_epi8(';')));
+	m = _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_set1_epi8('&')));
+	m = _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_set1_epi8('\'')));
+	m = _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_set1_epi8('"')));
+	m = _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_set1_epi8('$')));
+	return (_mm_movemask_epi8(m));
+}
+
+size_t	lexer_scan_sse2(const char *s, size_t pos, size_t len)
+{
+	int	mask;
+
+	while (pos + 16 <= len)
+	{
+		mask = sse2_class_mask(_mm_loadu_si128((const __m128i *)(s + pos)));
+		if (mask)
+			return (pos + __builtin_ctz(mask));
+		pos += 16;
+	}
+	return (lexer_scan_scalar(s, pos, len));
+}
+
+__attribute__((target("avx2")))
+static unsigned int	avx2_class_mask(__m256i v)
+{
+	__m256i	m;
+
+	m = _mm256_cmpeq_epi8(v, _mm256_set1_epi8(' '));
+	m = _mm256_or_si256(m, _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\t')));
+	m = _mm256_or_si256(m, _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\n')));
+	m = _mm256_or_si256(m, _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\r')));
+	m = _mm256_or_si256(m, _mm256_cmpeq_epi8(v, _mm256_set1_epi8('|')));
+	m = _mm256_or_si256(m, _mm256_cmpeq_epi8(v, _mm256_set1_epi8('<')));
+	m = _mm256_or_si256(m, _mm256_cmpeq_epi8(v, _mm256_set1_epi8('>')));
+	m = _mm256_or_si256(m, _mm256_cmpeq_epi8(v, _mm256_set1_epi8(';')));
+	m = _mm256_or_si256(m, _mm256_cmpeq_epi8(v, _mm256_set1_epi8('&')));
+	m = _mm256_or_si256(m, _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\'')));
+	m = _mm256_or_si256(m, _mm256_cmpeq_epi8(v, _mm256_set1_epi8('"')));
+	m = _mm256_or_si256(m, _mm256_cmpeq_epi8(v, _mm256_set1_epi8('$')));
+	return ((unsigned int)_mm256_movemask_epi8(m));
+}
+
+__attribute__((target("avx2")))
+size_t	lexer_scan_avx2(const char *s, size_t pos, size_t len)
+{
+	unsigned int	mask;
+
+	while (pos + 32 <= len)
+	{
+		mask = avx2_class_mask(
+				_mm256_loadu_si256((const __m256i *)(s + pos)));
+		if (mask)
+			return (pos + __builtin_ctz(mask));
+		pos += 32;
+	}
+	return (lexer_scan_sse2(s, pos, len));
+}
+
+/**
+ * @brief Picks the widest scanner the running CPU supports
+ */
+t_scan_fn	lexer_scan_best(void)
+{
+	if (__builtin_cpu_supports("avx2"))
+		return (lexer_scan_avx2);
+	if (__builtin_cpu_supports("sse2"))
+		return (lexer_scan_sse2);
+	return (lexer_scan_scalar);
+}
+
+#else
+
+size_t	lexer_scan_sse2(const char *s, size_t pos, size_t len)
+{
+	return (lexer_scan_scalar(s, pos, len));
+}
+
+size_t	lexer_scan_avx2(const char *s, size_t pos, size_t len)
+{
+	return (lexer_scan_scalar(s, pos, len));
+}
+
+t_scan_fn	lexer_scan_best(void)
+{
+	return (lexer_scan_scalar);
+}
+
+#endif
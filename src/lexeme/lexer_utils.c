@@ -13,50 +13,54 @@
 #include "tokens.h"
 #include "minishell.h"
 
-t_token	*create_token(t_token_type type, const char *value, size_t length)
+/**
+ * @brief Creates a token spanning input[start, start + length)
+ * @return Token owned by the lexer arena, or NULL on allocation failure
+ */
+t_token	*create_token(t_lexer *lexer, t_token_type type, size_t start,
+		size_t length)
 {
 	t_token	*token;
 
-	token = ft_calloc(1, sizeof(t_token));
+	token = token_arena_alloc(lexer);
 	if (!token)
 		return (NULL);
 	token->type = type;
+	token->start = start;
+	token->length = length;
 	token->quote_state = QUOTE_NONE;
-	if (value)
-	{
-		token->value = ft_substr(value, 0, length);
-		if (!token->value)
-		{
-			free(token);
-			return (NULL);
-		}
-		token->length = length;
-	}
-	else
-	{
-		token->value = NULL;
-		token->length = 0;
-	}
+	token->flags = 0;
+	token->io_fd = -1;
 	return (token);
 }
 
-t_token	*create_quoted_token(t_token_type type, const char *value,
-		size_t length, t_quote_state quote_state)
+/**
+ * @brief Returns a pointer to the first byte of a token in the input
+ * @details The text is not NUL-terminated; use token->length.
+ */
+const char	*token_text(t_lexer *lexer, t_token *token)
 {
-	t_token	*token;
-
-	token = create_token(type, value, length);
-	if (token)
-		token->quote_state = quote_state;
-	return (token);
+	return (lexer->input + token->start);
 }
 
-void	token_destroy(t_token *token)
+/**
+ * @brief Reads a pipe or list operator: |, ||, && or ;
+ */
+t_token	*lexer_read_operator(t_lexer *lexer)
 {
-	if (token)
+	size_t	start;
+	char	c;
+
+	start = lexer->pos;
+	c = lexer->input[lexer->pos++];
+	if (c == ';')
+		return (create_token(lexer, TOKEN_SEMICOLON, start, 1));
+	if (lexer->pos < lexer->len && lexer->input[lexer->pos] == c)
 	{
-		if (token->value)
-			free(token->value);
-		free(token);
+		lexer->pos++;
+		if (c == '&')
+			return (create_token(lexer, TOKEN_AND, start, 2));
+		return (create_token(lexer, TOKEN_OR, start, 2));
 	}
+	return (create_token(lexer, TOKEN_PIPE, start, 1));
 }
@@ -0,0 +1,54 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   token_arena.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/19 09:31:44 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/09/19 09:31:44 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "tokens.h"
+#include "minishell.h"
+
+/**
+ * @brief Hands out the next token slot, adding a chunk when the current
+ * one is full
+ * @details Only one allocation per TOKEN_ARENA_CHUNK tokens.
+ */
+t_token	*token_arena_alloc(t_lexer *lexer)
+{
+	t_token_chunk	*chunk;
+	t_token			*token;
+
+	chunk = lexer->chunks;
+	if (!chunk || chunk->used == TOKEN_ARENA_CHUNK)
+	{
+		chunk = malloc(sizeof(t_token_chunk));
+		if (!chunk)
+			return (NULL);
+		chunk->used = 0;
+		chunk->next = lexer->chunks;
+		lexer->chunks = chunk;
+	}
+	token = &chunk->tokens[chunk->used];
+	chunk->used++;
+	return (token);
+}
+
+/**
+ * @brief Releases every token of the lexer at once
+ */
+void	token_arena_release(t_lexer *lexer)
+{
+	t_token_chunk	*next;
+
+	while (lexer->chunks)
+	{
+		next = lexer->chunks->next;
+		free(lexer->chunks);
+		lexer->chunks = next;
+	}
+}
@@ -13,12 +13,12 @@
 #include "tokens.h"
 #include "minishell.h"
 
-static void	print_token_info(t_token *token)
+static void	print_token_info(t_lexer *lexer, t_token *token)
 {
-	if (token->value)
+	if (token->length)
 	{
 		ft_putstr_fd("Token: ", STDOUT_FILENO);
-		ft_putstr_fd(token->value, STDOUT_FILENO);
+		write(STDOUT_FILENO, token_text(lexer, token), token->length);
 		ft_putstr_fd(" (type: ", STDOUT_FILENO);
 		ft_putnbr_fd(token->type, STDOUT_FILENO);
 		ft_putendl_fd(")", STDOUT_FILENO);
@@ -36,19 +36,13 @@ static int	process_single_token(t_lexer *lexer)
 		return (1);
 	}
 	if (token->type == TOKEN_EOF)
-	{
-		token_destroy(token);
 		return (0);
-	}
 	else if (token->type == TOKEN_ERROR)
 	{
 		print_error("tokenizer", "Invalid token");
-		token_destroy(token);
 		return (1);
 	}
-	else
-		print_token_info(token);
-	token_destroy(token);
+	print_token_info(lexer, token);
 	return (-1);
 }
 
@@ -12,80 +12,79 @@
 
 #include "minishell.h"
 
-t_cmd	*init_cmd(void)
+/**
+ * @brief Allocates an empty command in the per-line arena
+ */
+t_cmd	*init_cmd(t_arena *arena)
 {
 	t_cmd	*cmd;
 
-	cmd = ft_calloc(1, sizeof(t_cmd));
+	cmd = arena_alloc(arena, sizeof(t_cmd));
 	if (!cmd)
 		return (NULL);
+	cmd->words = NULL;
+	cmd->word_flags = NULL;
+	cmd->argc = 0;
+	cmd->words_cap = 0;
 	cmd->argv = NULL;
+	cmd->builtin = BUILTIN_NONE;
+	cmd->loadable = NULL;
+	cmd->path = NULL;
+	cmd->in_shell = 0;
+	cmd->stage_in = -1;
+	cmd->stage_out = -1;
 	cmd->redirs = NULL;
+	cmd->redirs_tail = NULL;
 	cmd->next = NULL;
 	cmd->prev = NULL;
+	cmd->arena = arena;
 	return (cmd);
 }
 
-void	cmd_destroy(t_cmd *cmd)
+/**
+ * @brief Doubles the words and word_flags arrays so appends are amortised
+ * O(1)
+ * @details The old arrays stay in the arena; geometric growth keeps the
+ * total at O(N) pointers for N arguments.
+ */
+static int	cmd_grow_words(t_cmd *cmd)
 {
-	if (!cmd)
-		return ;
-	if (cmd->argv)
-		ft_strarr_free(cmd->argv);
-	if (cmd->redirs)
-		redir_destroy_list(cmd->redirs);
-	free(cmd);
-}
-
-void	cmd_destroy_list(t_cmd *cmd_list)
-{
-	t_cmd	*current;
-	t_cmd	*next;
-
-	current = cmd_list;
-	while (current)
-	{
-		next = current->next;
-		cmd_destroy(current);
-		current = next;
-	}
-}
+	char			**new_words;
+	unsigned char	*new_flags;
+	size_t			new_cap;
 
-static int	set_argv_with_cleanup(t_cmd *cmd, char **new_argv,
-						const char *arg, int argc)
-{
-	new_argv[argc] = ft_strdup(arg);
-	if (!new_argv[argc])
-	{
-		free(new_argv);
+	new_cap = 8;
+	if (cmd->words_cap)
+		new_cap = cmd->words_cap * 2;
+	new_words = arena_alloc(cmd->arena, sizeof(char *) * new_cap);
+	new_flags = arena_alloc(cmd->arena, new_cap);
+	if (!new_words || !new_flags)
 		return (0);
+	if (cmd->argc)
+	{
+		memcpy(new_words, cmd->words, sizeof(char *) * cmd->argc);
+		memcpy(new_flags, cmd->word_flags, cmd->argc);
 	}
-	new_argv[argc + 1] = NULL;
-	free(cmd->argv);
-	cmd->argv = new_argv;
+	cmd->words = new_words;
+	cmd->word_flags = new_flags;
+	cmd->words_cap = new_cap;
 	return (1);
 }
 
-int	cmd_add_arg(t_cmd *cmd, const char *arg)
+/**
+ * @brief Appends an unexpanded word (quotes included) to the command
+ */
+int	cmd_add_word(t_cmd *cmd, const t_word_span *word)
 {
-	char	**new_argv;
-	int		argc;
-	int		i;
-
-	if (!arg)
+	if (!word || !word->text)
 		return (0);
-	argc = 0;
-	if (cmd->argv)
-		while (cmd->argv[argc])
-			argc++;
-	new_argv = malloc(sizeof(char *) * (argc + 2));
-	if (!new_argv)
+	if (cmd->argc + 1 >= cmd->words_cap && !cmd_grow_words(cmd))
 		return (0);
-	i = 0;
-	while (i < argc)
-	{
-		new_argv[i] = cmd->argv[i];
-		i++;
-	}
-	return (set_argv_with_cleanup(cmd, new_argv, arg, argc));
+	cmd->words[cmd->argc] = arena_strndup(cmd->arena, word->text, word->len);
+	if (!cmd->words[cmd->argc])
+		return (0);
+	cmd->word_flags[cmd->argc] = (unsigned char)word->flags;
+	cmd->argc++;
+	cmd->words[cmd->argc] = NULL;
+	return (1);
 }
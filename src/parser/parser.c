@@ -24,9 +24,10 @@ t_parser	*parser_init(t_lexer *lexer, t_shell *shell)
 	}
 	parser->lexer = lexer;
 	parser->current_token = NULL;
-	parser->cmd_list = NULL;
+	parser->list = NULL;
 	parser->error = 0;
 	parser->shell = shell;
+	parser->arena = &shell->arena;
 	return (parser);
 }
 
@@ -34,17 +35,14 @@ void	parser_destroy(t_parser *parser)
 {
 	if (!parser)
 		return ;
-	if (parser->current_token)
-		token_destroy(parser->current_token);
 	free(parser);
 }
 
 int	parser_advance(t_parser *parser)
 {
-	if (parser->current_token)
-		token_destroy(parser->current_token);
 	parser->current_token = lexer_next_token(parser->lexer);
-	if (!parser->current_token)
+	if (!parser->current_token
+		|| parser->current_token->type == TOKEN_ERROR)
 	{
 		parser->error = 1;
 		return (0);
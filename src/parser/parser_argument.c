@@ -12,60 +12,33 @@
 
 #include "minishell.h"
 
-static char	*init_argument_result(t_parser *parser)
+/**
+ * @brief Consumes one shell word and returns its span in the input
+ * @details A word is a run of adjacent WORD tokens, e.g. a"b"'c'. The span
+ * keeps the quotes so the word can be expanded when it is executed; its
+ * flags are the union of the tokens' flags.
+ */
+int	parser_word_span(t_parser *parser, t_word_span *word)
 {
-	char	*result;
+	t_token	*token;
+	size_t	start;
+	size_t	end;
 
-	if (parser->current_token->value)
-		result = ft_strdup(parser->current_token->value);
-	else
-		result = ft_strdup("");
-	if (!result)
+	token = parser->current_token;
+	if (!token || token->type != TOKEN_WORD)
 	{
 		parser->error = 1;
-		return (NULL);
-	}
-	return (result);
-}
-
-char	*process_single_argument(t_parser *parser)
-{
-	char	*result;
-	size_t	last_token_end;
-
-	if (!parser->current_token || parser->current_token->type != TOKEN_WORD)
-		return (NULL);
-	if (expand_token(parser->current_token, parser->shell))
-	{
-		parser->error = 1;
-		return (NULL);
-	}
-	result = init_argument_result(parser);
-	if (!result)
-		return (NULL);
-	last_token_end = parser->lexer->pos;
-	if (!parser_advance(parser) || !process_additional_tokens(parser, &result,
-			&last_token_end))
-		return (NULL);
-	return (result);
-}
-
-int	parser_parse_arguments(t_parser *parser, t_cmd *cmd)
-{
-	char	*processed_arg;
-
-	while (parser->current_token && parser->current_token->type == TOKEN_WORD)
-	{
-		processed_arg = process_single_argument(parser);
-		if (!processed_arg)
-			return (0);
-		if (!cmd_add_arg(cmd, processed_arg))
-		{
-			free(processed_arg);
-			parser->error = 1;
-			return (0);
-		}
-		free(processed_arg);
+		return (0);
 	}
+	start = token->start;
+	if (token->quote_state != QUOTE_NONE)
+		start = token->start - 1;
+	end = parser->lexer->pos;
+	word->flags = token->flags;
+	if (!parser_advance(parser)
+		|| !process_additional_tokens(parser, &end, &word->flags))
+		return (0);
+	word->text = parser->lexer->input + start;
+	word->len = end - start;
 	return (1);
 }
@@ -20,17 +20,14 @@ static int	parse_setup(const char *input, t_lexer **lexer,
 		return (1);
 	*parser = parser_init(*lexer, shell);
 	if (!*parser)
-	{
-		lexer_destroy(*lexer);
 		return (1);
-	}
 	return (0);
 }
 
 static int	parse_execute(t_parser *parser)
 {
-	t_cmd	*cmd_list;
-	int		status;
+	t_pipeline	*cmd_list;
+	int			status;
 
 	cmd_list = parser_parse(parser);
 	if (parser->error || !cmd_list)
@@ -39,10 +36,8 @@ static int	parse_execute(t_parser *parser)
 		status = 1;
 	}
 	else
-	{
 		status = execute_command_list(cmd_list, parser->shell);
-		cmd_destroy_list(cmd_list);
-	}
+	arena_reset(&parser->shell->arena);
 	return (status);
 }
 
@@ -0,0 +1,124 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parser_list.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/23 09:48:36 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/09/23 09:48:36 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "minishell.h"
+
+static t_list_op	list_op_for(t_token *token)
+{
+	if (token->type == TOKEN_SEMICOLON)
+		return (LIST_SEQ);
+	if (token->type == TOKEN_AND)
+		return (LIST_AND);
+	if (token->type == TOKEN_OR)
+		return (LIST_OR);
+	return (LIST_END);
+}
+
+/**
+ * @brief Whether the current token is the reserved word word: unquoted,
+ * and not glued to what follows it
+ */
+static int	is_reserved(t_parser *parser, const char *word)
+{
+	t_token	*token;
+	size_t	len;
+	size_t	end;
+
+	token = parser->current_token;
+	len = ft_strlen(word);
+	if (token->type != TOKEN_WORD || token->flags || token->length != len
+		|| ft_strncmp(parser->lexer->input + token->start, word, len))
+		return (0);
+	end = token->start + len;
+	return (end >= parser->lexer->len
+		|| is_whitespace(parser->lexer->input[end])
+		|| is_metacharacter(parser->lexer->input[end]));
+}
+
+/**
+ * @brief Consumes "time" and "time -p" in front of a pipeline
+ * @return The TIME_REPORT_* mode, 0 without time, -1 on a lexer error
+ */
+static int	parse_time(t_parser *parser)
+{
+	int	mode;
+
+	mode = 0;
+	while (is_reserved(parser, "time"))
+	{
+		mode = TIME_REPORT_DEFAULT;
+		if (!parser_advance(parser))
+			return (-1);
+		if (is_reserved(parser, "-p"))
+			mode = TIME_REPORT_POSIX;
+		if (mode == TIME_REPORT_POSIX && !parser_advance(parser))
+			return (-1);
+	}
+	return (mode);
+}
+
+/**
+ * @brief Parses one pipeline of a list, with time in front of it; time
+ * alone is a pipeline with no commands
+ */
+static t_pipeline	*parse_list_node(t_parser *parser)
+{
+	t_pipeline	*node;
+
+	node = arena_alloc(parser->arena, sizeof(t_pipeline));
+	if (!node)
+	{
+		parser->error = 1;
+		return (NULL);
+	}
+	node->cmds = NULL;
+	node->op = LIST_END;
+	node->next = NULL;
+	node->timed = parse_time(parser);
+	if (node->timed == 0 || (node->timed > 0
+			&& list_op_for(parser->current_token) == LIST_END
+			&& parser->current_token->type != TOKEN_EOF))
+		node->cmds = parser_parse_pipeline(parser);
+	if (node->cmds || (node->timed > 0 && !parser->error))
+		return (node);
+	parser->error = 1;
+	return (NULL);
+}
+
+/**
+ * @brief Parses pipelines joined by ';', '&&' and '||'
+ * @details The operators are left-associative with equal precedence, so
+ * the list stays flat. A trailing ';' ends the list.
+ */
+t_pipeline	*parser_parse_list(t_parser *parser)
+{
+	t_pipeline	*head;
+	t_pipeline	*node;
+
+	head = parse_list_node(parser);
+	node = head;
+	while (node && list_op_for(parser->current_token) != LIST_END)
+	{
+		node->op = list_op_for(parser->current_token);
+		if (!parser_advance(parser))
+			return (NULL);
+		if (node->op == LIST_SEQ
+			&& parser->current_token->type == TOKEN_EOF)
+			break ;
+		node->next = parse_list_node(parser);
+		node = node->next;
+	}
+	if (!node)
+		return (NULL);
+	return (head);
+}
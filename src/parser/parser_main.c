@@ -12,37 +12,42 @@
 
 #include "minishell.h"
 
-t_cmd	*parser_parse(t_parser *parser)
+/**
+ * @brief Parses a whole line into a command list
+ * @return List in the shell arena, or NULL with parser->error set
+ */
+t_pipeline	*parser_parse(t_parser *parser)
 {
 	if (!parser_advance(parser))
 		return (NULL);
-	if (!parser_parse_pipeline(parser))
+	parser->list = parser_parse_list(parser);
+	if (parser->list && parser->current_token->type != TOKEN_EOF)
+		parser->error = 1;
+	if (parser->error)
 		return (NULL);
-	return (parser->cmd_list);
+	return (parser->list);
 }
 
-int	parser_parse_pipeline(t_parser *parser)
+t_cmd	*parser_parse_pipeline(t_parser *parser)
 {
+	t_cmd	*head;
 	t_cmd	*cmd;
 	t_cmd	*last_cmd;
 
-	cmd = parser_parse_command(parser);
-	if (!cmd || parser->error)
-		return (0);
-	parser->cmd_list = cmd;
-	last_cmd = cmd;
-	while (parser->current_token && parser->current_token->type == TOKEN_PIPE)
+	head = parser_parse_command(parser);
+	last_cmd = head;
+	while (last_cmd && parser->current_token->type == TOKEN_PIPE)
 	{
 		if (!parser_advance(parser))
-			return (0);
+			return (NULL);
 		cmd = parser_parse_command(parser);
-		if (!cmd || parser->error)
-			return (0);
+		if (!cmd)
+			return (NULL);
 		last_cmd->next = cmd;
 		cmd->prev = last_cmd;
 		last_cmd = cmd;
 	}
-	return (1);
+	return (head);
 }
 
 static int	parse_mixed_args_redirs(t_parser *parser, t_cmd *cmd)
@@ -64,16 +69,24 @@ static int	parse_mixed_args_redirs(t_parser *parser, t_cmd *cmd)
 	return (1);
 }
 
+/**
+ * @brief Parses one simple command; an empty one is a syntax error
+ */
 t_cmd	*parser_parse_command(t_parser *parser)
 {
 	t_cmd	*cmd;
 
-	cmd = init_cmd();
+	cmd = init_cmd(parser->arena);
 	if (!cmd)
+	{
+		parser->error = 1;
 		return (NULL);
+	}
 	if (!parse_mixed_args_redirs(parser, cmd))
+		return (NULL);
+	if (!cmd->argc && !cmd->redirs)
 	{
-		cmd_destroy(cmd);
+		parser->error = 1;
 		return (NULL);
 	}
 	return (cmd);
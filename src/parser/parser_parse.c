@@ -12,72 +12,45 @@
 
 #include "minishell.h"
 
-static int	validate_redir_token(t_parser *parser, t_redir_type *type)
+static int	validate_redir_token(t_parser *parser, t_redir_type *type,
+		int *io_fd)
 {
 	if (!parser->current_token
 		|| !parser_is_redir_token(parser->current_token->type))
 		return (0);
 	*type = parser_token_to_redir_type(parser->current_token->type);
+	*io_fd = parser->current_token->io_fd;
 	return (parser_advance(parser));
 }
 
-static int	process_redir_filename(t_parser *parser, t_cmd *cmd,
-		t_redir_type type)
+int	parser_parse_single_redir(t_parser *parser, t_cmd *cmd)
 {
-	if (!parser->current_token || parser->current_token->type != TOKEN_WORD)
-	{
-		parser->error = 1;
+	t_redir_type	type;
+	t_word_span		word;
+	int				io_fd;
+
+	if (!validate_redir_token(parser, &type, &io_fd))
 		return (0);
-	}
-	if (expand_token(parser->current_token, parser->shell))
-	{
-		parser->error = 1;
+	if (!parser_word_span(parser, &word))
 		return (0);
-	}
-	if (!cmd_add_redir_with_quote(cmd, type, parser->current_token->value,
-			parser->current_token->quote_state))
+	if (!cmd_add_redir(cmd, type, io_fd, &word))
 	{
 		parser->error = 1;
 		return (0);
 	}
-	return (parser_advance(parser));
-}
-
-int	parser_parse_single_redir(t_parser *parser, t_cmd *cmd)
-{
-	t_redir_type	type;
-
-	if (!validate_redir_token(parser, &type))
-		return (0);
-	return (process_redir_filename(parser, cmd, type));
+	return (1);
 }
 
 int	parser_parse_single_arg(t_parser *parser, t_cmd *cmd)
 {
-	char	*processed_arg;
+	t_word_span	word;
 
-	if (!parser->current_token || parser->current_token->type != TOKEN_WORD)
-		return (0);
-	processed_arg = process_single_argument(parser);
-	if (!processed_arg)
+	if (!parser_word_span(parser, &word))
 		return (0);
-	if (!cmd_add_arg(cmd, processed_arg))
+	if (!cmd_add_word(cmd, &word))
 	{
-		free(processed_arg);
 		parser->error = 1;
 		return (0);
 	}
-	free(processed_arg);
-	return (1);
-}
-
-int	parser_parse_redirections(t_parser *parser, t_cmd *cmd)
-{
-	while (parser->current_token
-		&& parser_is_redir_token(parser->current_token->type))
-	{
-		if (!parser_parse_single_redir(parser, cmd))
-			return (0);
-	}
 	return (1);
 }
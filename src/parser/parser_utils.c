@@ -15,7 +15,9 @@
 int	parser_is_redir_token(t_token_type type)
 {
 	return (type == TOKEN_REDIR_IN || type == TOKEN_REDIR_OUT
-		|| type == TOKEN_REDIR_APPEND || type == TOKEN_HEREDOC);
+		|| type == TOKEN_REDIR_APPEND || type == TOKEN_HEREDOC
+		|| type == TOKEN_DUP_IN || type == TOKEN_DUP_OUT
+		|| type == TOKEN_REDIR_ALL);
 }
 
 t_redir_type	parser_token_to_redir_type(t_token_type type)
@@ -28,47 +30,28 @@ t_redir_type	parser_token_to_redir_type(t_token_type type)
 		return (REDIR_APPEND);
 	else if (type == TOKEN_HEREDOC)
 		return (REDIR_HEREDOC);
+	else if (type == TOKEN_DUP_IN)
+		return (REDIR_DUP_IN);
+	else if (type == TOKEN_DUP_OUT)
+		return (REDIR_DUP_OUT);
+	else if (type == TOKEN_REDIR_ALL)
+		return (REDIR_OUT_ALL);
 	return (REDIR_IN);
 }
 
-void	redir_destroy(t_redir *redir)
-{
-	if (!redir)
-		return ;
-	if (redir->file)
-		free(redir->file);
-	free(redir);
-}
-
-void	redir_destroy_list(t_redir *redir_list)
-{
-	t_redir	*current;
-	t_redir	*next;
-
-	current = redir_list;
-	while (current)
-	{
-		next = current->next;
-		redir_destroy(current);
-		current = next;
-	}
-}
-
-int	init_lexer_parser(char *processed, t_lexer **lexer,
+/**
+ * @brief Sets up a lexer over the caller's line and a parser on top of it
+ * @details The line stays owned by the caller; parser_init releases the
+ * lexer when it fails.
+ */
+int	init_lexer_parser(char *input, t_lexer **lexer,
 		t_parser **parser, t_shell *sh)
 {
-	*lexer = lexer_init(processed);
+	*lexer = lexer_init(input);
 	if (!*lexer)
-	{
-		free(processed);
 		return (1);
-	}
 	*parser = parser_init(*lexer, sh);
 	if (!*parser)
-	{
-		lexer_destroy(*lexer);
-		free(processed);
 		return (1);
-	}
 	return (0);
 }
@@ -12,76 +12,53 @@
 
 #include "minishell.h"
 
-t_redir	*init_redir(t_redir_type type, const char *file)
+/**
+ * @brief Allocates a redirection to an unexpanded target word
+ * @details A heredoc whose delimiter is quoted anywhere keeps its body
+ * unexpanded. io_fd is the fd written before the operator, or -1 for the
+ * operator's own: stdin for "<", "<<" and "<&", stdout otherwise.
+ */
+t_redir	*init_redir(t_arena *arena, t_redir_type type, int io_fd,
+		const t_word_span *word)
 {
 	t_redir	*redir;
 
-	redir = ft_calloc(1, sizeof(t_redir));
+	redir = arena_alloc(arena, sizeof(t_redir));
 	if (!redir)
 		return (NULL);
 	redir->type = type;
-	redir->file = ft_strdup(file);
-	if (!redir->file)
-	{
-		free(redir);
+	redir->io_fd = io_fd;
+	if (io_fd < 0)
+		redir->io_fd = STDOUT_FILENO;
+	if (io_fd < 0 && (type == REDIR_IN || type == REDIR_HEREDOC
+			|| type == REDIR_DUP_IN))
+		redir->io_fd = STDIN_FILENO;
+	redir->word = arena_strndup(arena, word->text, word->len);
+	if (!redir->word)
 		return (NULL);
-	}
+	redir->file = NULL;
 	redir->fd = -1;
-	redir->expand = 1;
+	redir->expand = !(word->flags & TOKEN_HAS_QUOTE);
+	redir->flags = word->flags;
 	redir->next = NULL;
 	return (redir);
 }
 
-static t_redir	*redir_create_with_quote(t_redir_type type, const char *file,
-			t_quote_state quote_state)
+/**
+ * @brief Appends a redirection through the tail pointer, in O(1)
+ */
+int	cmd_add_redir(t_cmd *cmd, t_redir_type type, int io_fd,
+		const t_word_span *word)
 {
 	t_redir	*redir;
 
-	redir = init_redir(type, file);
+	redir = init_redir(cmd->arena, type, io_fd, word);
 	if (!redir)
-		return (NULL);
-	if (type == REDIR_HEREDOC)
-		redir->expand = (quote_state == QUOTE_NONE);
-	return (redir);
-}
-
-int	cmd_add_redir(t_cmd *cmd, t_redir_type type, const char *file)
-{
-	t_redir	*new_redir;
-	t_redir	*current;
-
-	new_redir = init_redir(type, file);
-	if (!new_redir)
-		return (0);
-	if (!cmd->redirs)
-	{
-		cmd->redirs = new_redir;
-		return (1);
-	}
-	current = cmd->redirs;
-	while (current->next)
-		current = current->next;
-	current->next = new_redir;
-	return (1);
-}
-
-int	cmd_add_redir_with_quote(t_cmd *cmd, t_redir_type type, const char *file,
-		t_quote_state quote_state)
-{
-	t_redir	*new_redir;
-	t_redir	*current;
-
-	new_redir = redir_create_with_quote(type, file, quote_state);
-	if (!new_redir)
 		return (0);
 	if (!cmd->redirs)
-	{
-		cmd->redirs = new_redir;
-		return (1);
-	}
-	current = cmd->redirs;
-	while (current->next)
-		current = current->next;
-	current->next = new_redir;
+		cmd->redirs = redir;
+	else
+		cmd->redirs_tail->next = redir;
+	cmd->redirs_tail = redir;
 	return (1);
 }
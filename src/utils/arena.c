@@ -0,0 +1,124 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arena.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/21 16:10:02 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/09/21 16:10:02 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "arena.h"
+#include <stdlib.h>
+
+static t_arena_block	*arena_block_new(t_arena *arena, size_t size)
+{
+	t_arena_block	*block;
+
+	if (size < arena->block_size)
+		size = arena->block_size;
+	if (!arena->block_size && size < ARENA_BLOCK_SIZE)
+		size = ARENA_BLOCK_SIZE;
+	block = malloc(ARENA_HEADER + size);
+	if (!block)
+		return (NULL);
+	block->next = NULL;
+	block->cap = size;
+	block->used = 0;
+	return (block);
+}
+
+/**
+ * @brief Moves to a block with room for size bytes
+ * @details Blocks kept from earlier lines are reused in order; a new block
+ * is linked in after the current one only when the next one is too small.
+ */
+static t_arena_block	*arena_next_block(t_arena *arena, size_t size)
+{
+	t_arena_block	*block;
+
+	if (arena->cur && arena->cur->next && arena->cur->next->cap >= size)
+	{
+		arena->cur = arena->cur->next;
+		arena->cur->used = 0;
+		return (arena->cur);
+	}
+	block = arena_block_new(arena, size);
+	if (!block)
+		return (NULL);
+	if (arena->cur)
+	{
+		block->next = arena->cur->next;
+		arena->cur->next = block;
+	}
+	else
+		arena->head = block;
+	arena->cur = block;
+	return (block);
+}
+
+/**
+ * @brief Allocates size bytes that live until the next arena_reset
+ * @return Pointer aligned to ARENA_ALIGN, or NULL on failure
+ */
+void	*arena_alloc(t_arena *arena, size_t size)
+{
+	t_arena_block	*block;
+	void			*ptr;
+
+	if (ARENA_DEBUG)
+		return (arena_debug_alloc(arena, size));
+	size = (size + ARENA_ALIGN - 1) & ~((size_t)ARENA_ALIGN - 1);
+	block = arena->cur;
+	if (!block || block->cap - block->used < size)
+		block = arena_next_block(arena, size);
+	if (!block)
+		return (NULL);
+	ptr = (char *)block + ARENA_HEADER + block->used;
+	block->used += size;
+	return (ptr);
+}
+
+/**
+ * @brief Releases every allocation at once
+ * @details Rewinds to the first block and keeps the leading blocks, up to
+ * ARENA_KEEP_BLOCKS block sizes, for the next line; the rest are freed,
+ * so one very long line does not hold its peak for the whole session. In
+ * debug mode every allocation is freed instead.
+ */
+void	arena_reset(t_arena *arena)
+{
+	t_arena_block	**link;
+	size_t			keep;
+
+	if (ARENA_DEBUG)
+	{
+		arena_free_blocks(arena->head);
+		arena->head = NULL;
+	}
+	keep = arena->block_size;
+	if (!keep)
+		keep = ARENA_BLOCK_SIZE;
+	keep *= ARENA_KEEP_BLOCKS;
+	link = &arena->head;
+	while (*link && (*link)->cap <= keep)
+	{
+		keep -= (*link)->cap;
+		link = &(*link)->next;
+	}
+	arena_free_blocks(*link);
+	*link = NULL;
+	arena->cur = arena->head;
+	if (arena->cur)
+		arena->cur->used = 0;
+}
+
+void	arena_destroy(t_arena *arena)
+{
+	arena_free_blocks(arena->head);
+	arena->head = NULL;
+	arena->cur = NULL;
+}
@@ -0,0 +1,66 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arena_utils.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/21 16:31:19 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/09/21 16:31:19 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "arena.h"
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @brief Debug-mode allocation: one malloc per request
+ * @details Each allocation gets its own block on the head list so that
+ * arena_reset frees it and valgrind reports any later use.
+ */
+void	*arena_debug_alloc(t_arena *arena, size_t size)
+{
+	t_arena_block	*block;
+
+	block = malloc(sizeof(t_arena_block) + size);
+	if (!block)
+		return (NULL);
+	block->cap = size;
+	block->used = size;
+	block->next = arena->head;
+	arena->head = block;
+	return (block + 1);
+}
+
+void	arena_free_blocks(t_arena_block *block)
+{
+	t_arena_block	*next;
+
+	while (block)
+	{
+		next = block->next;
+		free(block);
+		block = next;
+	}
+}
+
+char	*arena_strndup(t_arena *arena, const char *s, size_t len)
+{
+	char	*copy;
+
+	copy = arena_alloc(arena, len + 1);
+	if (!copy)
+		return (NULL);
+	memcpy(copy, s, len);
+	copy[len] = '\0';
+	return (copy);
+}
+
+char	*arena_strdup(t_arena *arena, const char *s)
+{
+	if (!s)
+		return (NULL);
+	return (arena_strndup(arena, s, strlen(s)));
+}
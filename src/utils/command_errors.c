@@ -14,10 +14,34 @@
 
 void	print_command_error(const char *command, const char *error)
 {
-	ft_putstr_fd("minishell: ", STDERR_FILENO);
-	ft_putstr_fd((char *)command, STDERR_FILENO);
-	ft_putstr_fd(": ", STDERR_FILENO);
-	ft_putendl_fd((char *)error, STDERR_FILENO);
+	const char	*parts[6];
+
+	parts[0] = "minishell: ";
+	parts[1] = command;
+	parts[2] = ": ";
+	parts[3] = error;
+	parts[4] = "\n";
+	parts[5] = NULL;
+	write_error_line(parts);
+}
+
+/**
+ * @brief Prints "minishell: builtin: arg: message"
+ */
+void	print_arg_error(const char *builtin, const char *arg,
+		const char *message)
+{
+	const char	*parts[8];
+
+	parts[0] = "minishell: ";
+	parts[1] = builtin;
+	parts[2] = ": ";
+	parts[3] = arg;
+	parts[4] = ": ";
+	parts[5] = message;
+	parts[6] = "\n";
+	parts[7] = NULL;
+	write_error_line(parts);
 }
 
 int	handle_execution_error(int error_code, const char *command)
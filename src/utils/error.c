@@ -12,15 +12,53 @@
 
 #include "minishell.h"
 
+/**
+ * @brief Joins parts into one stack line and writes it with a single
+ * write, so concurrent stages cannot interleave inside a message; text
+ * past ERR_LINE_MAX is written in further chunks
+ */
+void	write_error_line(const char **parts)
+{
+	char	line[ERR_LINE_MAX];
+	size_t	len;
+	size_t	n;
+
+	len = 0;
+	while (*parts)
+	{
+		n = strlen(*parts);
+		if (len + n > ERR_LINE_MAX && len)
+		{
+			write_full(STDERR_FILENO, line, len);
+			len = 0;
+		}
+		if (n > ERR_LINE_MAX)
+			write_full(STDERR_FILENO, *parts, n);
+		else
+			memcpy(line + len, *parts, n);
+		if (n <= ERR_LINE_MAX)
+			len += n;
+		parts++;
+	}
+	if (len)
+		write_full(STDERR_FILENO, line, len);
+}
+
 void	print_error(const char *context, const char *message)
 {
-	ft_putstr_fd("minishell: ", STDERR_FILENO);
+	const char	*parts[6];
+	int			i;
+
+	i = 0;
+	parts[i++] = "minishell: ";
 	if (context)
 	{
-		ft_putstr_fd((char *)context, STDERR_FILENO);
-		ft_putstr_fd(": ", STDERR_FILENO);
+		parts[i++] = context;
+		parts[i++] = ": ";
 	}
 	if (message)
-		ft_putstr_fd((char *)message, STDERR_FILENO);
-	ft_putchar_fd('\n', STDERR_FILENO);
+		parts[i++] = message;
+	parts[i++] = "\n";
+	parts[i] = NULL;
+	write_error_line(parts);
 }
@@ -0,0 +1,71 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   output.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/30 14:10:51 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/09/30 14:10:51 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+void	out_init(t_outbuf *out, int fd)
+{
+	out->fd = fd;
+	out->error = 0;
+	out->len = 0;
+}
+
+/**
+ * @brief Writes out and empties the buffer
+ * @return 0, or the errno of the first write that failed since the last
+ * flush; the error is cleared for the next builtin
+ */
+int	out_flush(t_outbuf *out)
+{
+	int	error;
+
+	if (out->len && write_full(out->fd, out->data, out->len) == -1
+		&& !out->error)
+		out->error = errno;
+	out->len = 0;
+	error = out->error;
+	out->error = 0;
+	return (error);
+}
+
+/**
+ * @brief Appends len bytes, flushing when the buffer fills; a chunk
+ * larger than the buffer is written directly
+ */
+void	out_write(t_outbuf *out, const char *s, size_t len)
+{
+	if (out->len + len > OUT_BUF_SIZE && out->len)
+	{
+		if (write_full(out->fd, out->data, out->len) == -1 && !out->error)
+			out->error = errno;
+		out->len = 0;
+	}
+	if (len > OUT_BUF_SIZE)
+	{
+		if (write_full(out->fd, s, len) == -1 && !out->error)
+			out->error = errno;
+		return ;
+	}
+	memcpy(out->data + out->len, s, len);
+	out->len += len;
+}
+
+void	out_puts(t_outbuf *out, const char *s)
+{
+	if (s)
+		out_write(out, s, strlen(s));
+}
+
+void	out_putc(t_outbuf *out, char c)
+{
+	out_write(out, &c, 1);
+}
@@ -0,0 +1,65 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   output_number.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/10/06 14:12:09 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/10/06 14:12:09 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Appends n in decimal
+ */
+void	out_putnbr(t_outbuf *out, long n)
+{
+	char			digits[24];
+	unsigned long	u;
+	size_t			i;
+
+	u = n;
+	if (n < 0)
+	{
+		out_putc(out, '-');
+		u = -(unsigned long)n;
+	}
+	i = sizeof(digits);
+	digits[--i] = '0' + u % 10;
+	while (u >= 10)
+	{
+		u /= 10;
+		digits[--i] = '0' + u % 10;
+	}
+	out_write(out, digits + i, sizeof(digits) - i);
+}
+
+/**
+ * @brief Appends usec microseconds as seconds with precision decimals,
+ * truncated: 1250000 is "1.250" with 3 and "1" with 0
+ */
+void	out_putseconds(t_outbuf *out, long usec, int precision)
+{
+	char	fraction[6];
+	int		i;
+
+	if (usec < 0)
+		usec = 0;
+	if (precision > 6)
+		precision = 6;
+	out_putnbr(out, usec / 1000000);
+	if (precision <= 0)
+		return ;
+	out_putc(out, '.');
+	usec %= 1000000;
+	i = 6;
+	while (i-- > 0)
+	{
+		fraction[i] = '0' + usec % 10;
+		usec /= 10;
+	}
+	out_write(out, fraction, precision);
+}
@@ -0,0 +1,119 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   trace.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/10/08 09:40:17 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/10/08 09:40:17 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Appends s as a JSON string
+ * @details Control characters and bytes from 0x80 up are written as
+ * \u00XX: a name or path need not be valid UTF-8, and the file must stay
+ * valid JSON. Such a byte reads as the Latin-1 character of its value.
+ */
+void	trace_put_string(t_outbuf *out, const char *s)
+{
+	const char		*hex;
+	unsigned char	c;
+
+	hex = "0123456789abcdef";
+	out_putc(out, '"');
+	while (*s)
+	{
+		c = (unsigned char)*s++;
+		if (c == '"' || c == '\\')
+			out_putc(out, '\\');
+		if (c < 0x20 || c >= 0x80)
+		{
+			out_puts(out, "\\u00");
+			out_putc(out, hex[c >> 4]);
+			out_putc(out, hex[c & 15]);
+		}
+		else
+			out_putc(out, c);
+	}
+	out_putc(out, '"');
+}
+
+/**
+ * @brief Appends an event up to its last field: name, phase, a timestamp
+ * in microseconds of CLOCK_MONOTONIC, and the track of process pid; the
+ * caller adds any "args" and the closing "},\n"
+ */
+void	trace_put_head(t_outbuf *out, const char *name, char phase,
+		pid_t pid)
+{
+	struct timespec	now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	out_puts(out, "{\"name\":");
+	trace_put_string(out, name);
+	out_puts(out, ",\"ph\":\"");
+	out_putc(out, phase);
+	out_puts(out, "\",\"ts\":");
+	out_putnbr(out, now.tv_sec * 1000000L + now.tv_nsec / 1000);
+	out_puts(out, ",\"pid\":");
+	out_putnbr(out, pid);
+	out_puts(out, ",\"tid\":");
+	out_putnbr(out, pid);
+	if (phase == TRACE_INSTANT)
+		out_puts(out, ",\"s\":\"t\"");
+}
+
+/**
+ * @brief Starts a trace in the file at path when it is set: the file is
+ * truncated and opened for appending, so that every event, from the shell
+ * or from a forked child, lands whole with a single write
+ * @details Tracing stays off when the file cannot be opened. The shell's
+ * track is named "minishell".
+ */
+void	trace_open(t_trace *trace, const char *path)
+{
+	t_outbuf	out;
+
+	trace->on = 0;
+	trace->pid = getpid();
+	if (!path || !*path)
+		return ;
+	trace->fd = open(path, O_WRONLY | O_CREAT | O_TRUNC | O_APPEND
+			| O_CLOEXEC, 0644);
+	if (trace->fd == -1)
+	{
+		print_arg_error(TRACE_VAR, path, strerror(errno));
+		return ;
+	}
+	trace->on = 1;
+	out_init(&out, trace->fd);
+	out_puts(&out, "[\n");
+	trace_put_head(&out, "process_name", TRACE_METADATA, trace->pid);
+	out_puts(&out, ",\"args\":{\"name\":\"minishell\"}},\n");
+	out_flush(&out);
+}
+
+/**
+ * @brief Ends the trace: the shell closes the JSON array with a last
+ * "exit" event, a forked child only closes its copy of the file
+ */
+void	trace_close(t_trace *trace)
+{
+	t_outbuf	out;
+
+	if (!trace->on)
+		return ;
+	if (getpid() == trace->pid)
+	{
+		out_init(&out, trace->fd);
+		trace_put_head(&out, "exit", TRACE_INSTANT, trace->pid);
+		out_puts(&out, "}\n]\n");
+		out_flush(&out);
+	}
+	close(trace->fd);
+	trace->on = 0;
+}
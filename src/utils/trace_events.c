@@ -0,0 +1,99 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   trace_events.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/10/08 10:05:33 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/10/08 10:05:33 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/*
+** Every hook returns at once when tracing is off; the per-phase one does
+** not even set up an event buffer.
+*/
+
+static void	write_event(const t_trace *trace, const char *name, char phase,
+		pid_t pid)
+{
+	t_outbuf	out;
+
+	out_init(&out, trace->fd);
+	trace_put_head(&out, name, phase, pid);
+	out_puts(&out, "},\n");
+	out_flush(&out);
+}
+
+/**
+ * @brief Marks the beginning or the end of a phase on the track of the
+ * calling process: the shell's, or a forked child's
+ */
+void	trace_event(const t_trace *trace, const char *name, char phase)
+{
+	if (!trace->on)
+		return ;
+	write_event(trace, name, phase, getpid());
+}
+
+/**
+ * @brief Opens the track of a child, named after its command, with a span
+ * that lasts until it is reaped: written by a forked child itself, or by
+ * the shell once posix_spawn returns
+ */
+void	trace_child_start(const t_trace *trace, pid_t pid, const char *name)
+{
+	t_outbuf	out;
+
+	if (!trace->on)
+		return ;
+	if (!name)
+		name = "child";
+	out_init(&out, trace->fd);
+	trace_put_head(&out, "process_name", TRACE_METADATA, pid);
+	out_puts(&out, ",\"args\":{\"name\":");
+	trace_put_string(&out, name);
+	out_puts(&out, "}},\n");
+	trace_put_head(&out, name, TRACE_BEGIN, pid);
+	out_puts(&out, "},\n");
+	out_flush(&out);
+}
+
+/**
+ * @brief Ends the span of a reaped child with its exit status
+ */
+void	trace_child_end(const t_trace *trace, pid_t pid, int status)
+{
+	t_outbuf	out;
+
+	if (!trace->on)
+		return ;
+	out_init(&out, trace->fd);
+	trace_put_head(&out, "", TRACE_END, pid);
+	out_puts(&out, ",\"args\":{\"status\":");
+	out_putnbr(&out, status);
+	out_puts(&out, "}},\n");
+	out_flush(&out);
+}
+
+/**
+ * @brief Marks the execve of path on the track of child pid: written by a
+ * forked child right before it, or by the shell once posix_spawn, which
+ * returns after the exec, is done
+ */
+void	trace_execve(const t_trace *trace, pid_t pid, const char *path)
+{
+	t_outbuf	out;
+
+	if (!trace->on)
+		return ;
+	out_init(&out, trace->fd);
+	trace_put_head(&out, "execve", TRACE_INSTANT, pid);
+	out_puts(&out, ",\"args\":{\"path\":");
+	trace_put_string(&out, path);
+	out_puts(&out, "}},\n");
+	out_flush(&out);
+}
@@ -0,0 +1,123 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_argv.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/22 10:27:40 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/09/22 10:27:40 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "minishell.h"
+#include <time.h>
+
+/*
+** Scaling benchmark for argument building.
+** Parses "rm path0 path1 ..." with 1k, 10k and 100k arguments; with
+** amortised argv growth the cost per argument stays flat. The "legacy"
+** column replays the old cmd_add_arg (count, copy, free on every append)
+** on the same argument count, up to LEGACY_MAX_ARGS (100k takes ~20s).
+*/
+
+#define LEGACY_MAX_ARGS 20000
+
+static double	elapsed_ms(struct timespec *start)
+{
+	struct timespec	end;
+
+	clock_gettime(CLOCK_MONOTONIC, &end);
+	return ((end.tv_sec - start->tv_sec) * 1e3
+		+ (end.tv_nsec - start->tv_nsec) / 1e6);
+}
+
+static char	*build_line(size_t args)
+{
+	char	*line;
+	size_t	pos;
+	size_t	i;
+
+	line = malloc(args * 16 + 8);
+	if (!line)
+		return (NULL);
+	pos = sprintf(line, "rm");
+	i = 0;
+	while (i < args)
+		pos += sprintf(line + pos, " dir/f%zu", i++);
+	return (line);
+}
+
+static double	parse_ms(t_shell *sh, char *line, size_t *argc)
+{
+	struct timespec	start;
+	t_lexer			*lexer;
+	t_parser		*parser;
+	t_pipeline		*list;
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	*argc = 0;
+	if (init_lexer_parser(line, &lexer, &parser, sh))
+		return (0);
+	list = parser_parse(parser);
+	if (list)
+		*argc = list->cmds->argc;
+	parser_destroy(parser);
+	lexer_destroy(lexer);
+	arena_reset(&sh->arena);
+	return (elapsed_ms(&start));
+}
+
+static double	legacy_ms(size_t args)
+{
+	struct timespec	start;
+	char			**argv;
+	char			**new_argv;
+	size_t			argc;
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	argv = NULL;
+	while (args--)
+	{
+		argc = 0;
+		while (argv && argv[argc])
+			argc++;
+		new_argv = malloc(sizeof(char *) * (argc + 2));
+		if (argc)
+			memcpy(new_argv, argv, sizeof(char *) * argc);
+		new_argv[argc] = ft_strdup("dir/f");
+		new_argv[argc + 1] = NULL;
+		free(argv);
+		argv = new_argv;
+	}
+	ft_strarr_free(argv);
+	return (elapsed_ms(&start));
+}
+
+int	main(void)
+{
+	const size_t	sizes[3] = {1000, 10000, 100000};
+	t_shell			sh;
+	char			*line;
+	double			ms;
+	size_t			argc;
+	int				i;
+
+	ft_bzero(&sh, sizeof(sh));
+	printf("%8s %10s %10s %12s\n", "args", "parse", "ns/arg", "legacy argv");
+	i = -1;
+	while (++i < 3)
+	{
+		line = build_line(sizes[i]);
+		ms = parse_ms(&sh, line, &argc);
+		printf("%8zu %7.2f ms %10.0f", argc - 1, ms, ms * 1e6 / argc);
+		if (sizes[i] <= LEGACY_MAX_ARGS)
+			printf(" %9.2f ms\n", legacy_ms(sizes[i]));
+		else
+			printf("   (skipped)\n");
+		free(line);
+	}
+	arena_destroy(&sh.arena);
+	return (0);
+}
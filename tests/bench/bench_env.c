@@ -0,0 +1,131 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_env.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/26 11:35:14 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/09/26 11:35:14 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "minishell.h"
+#include <time.h>
+
+/*
+** Benchmark for large environments, as on CI runners started with
+** thousands of variables. Times $VAR expansion, export of new and existing
+** names, unset, and building the execve array after a change.
+*/
+
+#define ENV_SIZES 3
+#define LOOKUPS 200000
+#define EXPORTS 5000
+
+static double	now_seconds(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec + ts.tv_nsec / 1e9);
+}
+
+static char	**build_envp(size_t n)
+{
+	char	**envp;
+	size_t	i;
+
+	envp = ft_calloc(n + 1, sizeof(char *));
+	if (!envp)
+		return (NULL);
+	i = 0;
+	while (i < n)
+	{
+		envp[i] = malloc(80);
+		if (!envp[i])
+			return (ft_strarr_free(envp), NULL);
+		snprintf(envp[i], 80, "CI_VAR_%zu=value_of_variable_%zu", i, i);
+		i++;
+	}
+	return (envp);
+}
+
+static void	bench_lookup(t_shell *sh, size_t n)
+{
+	char	word[32];
+	char	*value;
+	double	start;
+	size_t	i;
+
+	start = now_seconds();
+	i = 0;
+	while (i < LOOKUPS)
+	{
+		snprintf(word, sizeof(word), "$CI_VAR_%zu", (i * 7919) % n);
+		value = expand_string(word, sh, QUOTE_NONE);
+		free(value);
+		i++;
+	}
+	start = now_seconds() - start;
+	printf("  %5zu vars: expand $VAR %8.0f ns", n, start / LOOKUPS * 1e9);
+}
+
+static void	bench_export(t_shell *sh)
+{
+	char	name[32];
+	double	start;
+	double	middle;
+	size_t	i;
+
+	start = now_seconds();
+	i = 0;
+	while (i < EXPORTS * 2)
+	{
+		snprintf(name, sizeof(name), "NEW_%zu", i % EXPORTS);
+		env_set_var(sh, name, "x");
+		i++;
+	}
+	middle = now_seconds();
+	i = 0;
+	while (i < EXPORTS)
+	{
+		snprintf(name, sizeof(name), "NEW_%zu", i++);
+		env_unset_var(sh, name);
+	}
+	printf(", export %6.0f ns, unset %6.0f ns\n",
+		(middle - start) / (EXPORTS * 2) * 1e9,
+		(now_seconds() - middle) / EXPORTS * 1e9);
+}
+
+int	main(void)
+{
+	static const size_t	sizes[ENV_SIZES] = {100, 2000, 5000};
+	t_shell				sh;
+	char				**envp;
+	double				start;
+	size_t				i;
+
+	printf("environment (%d lookups, %d exports of new and existing names)\n",
+		LOOKUPS, EXPORTS);
+	i = 0;
+	while (i < ENV_SIZES)
+	{
+		ft_bzero(&sh, sizeof(sh));
+		envp = build_envp(sizes[i]);
+		if (!envp || env_init(&sh.env, envp))
+			return (1);
+		bench_lookup(&sh, sizes[i]);
+		bench_export(&sh);
+		env_set_var(&sh, "DIRTY", "1");
+		start = now_seconds();
+		env_envp(&sh.env);
+		printf("  %5zu vars: rebuild envp after a change %.1f us\n",
+			sh.env.count, (now_seconds() - start) * 1e6);
+		env_destroy(&sh.env);
+		ft_strarr_free(envp);
+		i++;
+	}
+	return (0);
+}
@@ -0,0 +1,144 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_expand.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/25 11:03:26 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/09/25 11:03:26 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "minishell.h"
+#include <time.h>
+
+/*
+** Throughput benchmark for expand_string().
+** Expands one long literal word unquoted and in double quotes, where the
+** expander should copy whole runs, then a word made only of variable
+** references whose values are appended with one copy each.
+*/
+
+#define LITERAL_BYTES 1048576
+#define LITERAL_ROUNDS 64
+#define VAR_REFS 65536
+#define VAR_ROUNDS 16
+#define VALUE_LEN 64
+
+static double	now_seconds(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec + ts.tv_nsec / 1e9);
+}
+
+static char	*build_literal(size_t len)
+{
+	char	*word;
+	size_t	i;
+
+	word = malloc(len + 1);
+	if (!word)
+		return (NULL);
+	i = 0;
+	while (i < len)
+	{
+		word[i] = 'a' + i % 26;
+		i++;
+	}
+	word[len] = '\0';
+	return (word);
+}
+
+static char	*build_refs(size_t refs)
+{
+	char	*word;
+	size_t	pos;
+	size_t	i;
+
+	word = malloc(refs * 8 + 1);
+	if (!word)
+		return (NULL);
+	pos = 0;
+	i = 0;
+	while (i < refs)
+		pos += sprintf(word + pos, "$BENCH%zu", i++ % 4);
+	return (word);
+}
+
+static void	bench_expand(const char *name, const char *word, t_shell *sh,
+		t_quote_state state)
+{
+	double	start;
+	size_t	rounds;
+	size_t	i;
+	size_t	out;
+	char	*result;
+
+	rounds = LITERAL_ROUNDS;
+	if (word[0] == '$')
+		rounds = VAR_ROUNDS;
+	out = 0;
+	start = now_seconds();
+	i = 0;
+	while (i++ < rounds)
+	{
+		result = expand_string(word, sh, state);
+		if (result)
+			out = strlen(result);
+		free(result);
+	}
+	start = now_seconds() - start;
+	printf("  %-22s %9.1f MB/s in, %9.1f MB/s out\n", name,
+		strlen(word) * (double)rounds / start / 1e6,
+		out * (double)rounds / start / 1e6);
+}
+
+static char	**build_env(void)
+{
+	char	**envp;
+	char	*value;
+	char	name[16];
+	int		i;
+
+	envp = ft_calloc(5, sizeof(char *));
+	value = build_literal(VALUE_LEN);
+	if (!envp || !value)
+		return (free(envp), free(value), NULL);
+	i = 0;
+	while (i < 4)
+	{
+		snprintf(name, sizeof(name), "BENCH%d=", i);
+		envp[i++] = ft_strjoin(name, value);
+	}
+	free(value);
+	return (envp);
+}
+
+int	main(void)
+{
+	t_shell	sh;
+	char	*literal;
+	char	*refs;
+	char	**envp;
+
+	ft_bzero(&sh, sizeof(sh));
+	literal = build_literal(LITERAL_BYTES);
+	refs = build_refs(VAR_REFS);
+	envp = build_env();
+	if (!literal || !refs || !envp || env_init(&sh.env, envp))
+		return (1);
+	printf("expand_string (1MB literal, %d x $VAR of %dB)\n",
+		VAR_REFS, VALUE_LEN);
+	bench_expand("literal, unquoted", literal, &sh, QUOTE_NONE);
+	bench_expand("literal, double quotes", literal, &sh, QUOTE_DOUBLE);
+	bench_expand("variables", refs, &sh, QUOTE_NONE);
+	env_destroy(&sh.env);
+	ft_strarr_free(envp);
+	free(literal);
+	free(refs);
+	return (0);
+}
@@ -0,0 +1,114 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_heredoc.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/30 10:05:19 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/09/30 10:05:19 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "minishell.h"
+#include <time.h>
+
+/*
+** Benchmark for heredoc materialization: a templated config file of short
+** lines with a few variable references each, written to /dev/null. legacy
+** is the old per-line path (expand_string, then one write for the line
+** and one for its newline); stream is heredoc_write_line on a streaming
+** expander.
+*/
+
+#define LINES 1000000
+
+#define TEMPLATE "    server_name $HOST; listen $PORT; root /srv/$USER/html;"
+
+static double	now_seconds(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec + ts.tv_nsec / 1e9);
+}
+
+static size_t	run_legacy(t_shell *sh, int fd)
+{
+	char	*line;
+	size_t	out;
+	size_t	i;
+
+	out = 0;
+	i = 0;
+	while (i++ < LINES)
+	{
+		line = expand_string(TEMPLATE, sh, QUOTE_NONE);
+		if (!line)
+			return (0);
+		write_full(fd, line, strlen(line));
+		write_full(fd, "\n", 1);
+		out += strlen(line) + 1;
+		free(line);
+	}
+	return (out);
+}
+
+static size_t	run_stream(t_shell *sh, int fd)
+{
+	t_expander	stream;
+	t_redir		redir;
+	char		*line;
+	size_t		len;
+	size_t		i;
+
+	ft_bzero(&redir, sizeof(redir));
+	redir.expand = 1;
+	line = expand_string(TEMPLATE, sh, QUOTE_NONE);
+	expander_begin(&stream, sh);
+	if (!line || expander_stream(&stream, fd))
+		return (free(line), 0);
+	len = strlen(TEMPLATE);
+	i = 0;
+	while (i++ < LINES)
+		heredoc_write_line(&stream, &redir, TEMPLATE, len);
+	expander_flush(&stream);
+	len = (strlen(line) + 1) * LINES;
+	free(line);
+	return (len);
+}
+
+static void	report(const char *name, size_t (*run)(t_shell *, int),
+		t_shell *sh, int fd)
+{
+	double	start;
+	size_t	out;
+
+	start = now_seconds();
+	out = run(sh, fd);
+	start = now_seconds() - start;
+	printf("  %-7s %9.0f lines/s, %7.1f MB/s out\n", name, LINES / start,
+		out / start / 1e6);
+}
+
+int	main(void)
+{
+	t_shell	sh;
+	int		fd;
+
+	ft_bzero(&sh, sizeof(sh));
+	if (env_init(&sh.env, (char *[]){"HOST=example.org", "PORT=8080",
+			"USER=www", NULL}))
+		return (1);
+	fd = open("/dev/null", O_WRONLY);
+	if (fd == -1)
+		return (1);
+	printf("heredoc body (%d templated lines to /dev/null)\n", LINES);
+	report("legacy", run_legacy, &sh, fd);
+	report("stream", run_stream, &sh, fd);
+	close(fd);
+	env_destroy(&sh.env);
+	free(sh.expand_buf);
+	return (0);
+}
@@ -0,0 +1,116 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_input.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/18 11:05:47 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/09/18 11:05:47 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+#include <time.h>
+
+/*
+** Throughput benchmark for the non-interactive line readers.
+** Writes a generated script to a temporary file and reads it back with
+** get_next_line (the previous reader) and with the block-buffered input
+** source, reporting lines/sec and MB/sec for each.
+*/
+
+#define BENCH_FILE "/tmp/minishell_bench_input.txt"
+
+static double	now_seconds(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec + ts.tv_nsec / 1e9);
+}
+
+static size_t	write_script(size_t n_lines, size_t line_len)
+{
+	FILE	*f;
+	size_t	i;
+	size_t	j;
+
+	f = fopen(BENCH_FILE, "w");
+	if (!f)
+		return (0);
+	i = 0;
+	while (i < n_lines)
+	{
+		fputs("echo ", f);
+		j = 5;
+		while (++j < line_len)
+			fputc('a' + (i + j) % 26, f);
+		fputc('\n', f);
+		i++;
+	}
+	fclose(f);
+	return (n_lines * line_len);
+}
+
+static size_t	read_all(int use_gnl)
+{
+	t_input	in;
+	char	*line;
+	size_t	count;
+	int		fd;
+
+	fd = open(BENCH_FILE, O_RDONLY);
+	count = 0;
+	if (use_gnl)
+	{
+		line = get_next_line(fd);
+		while (line)
+		{
+			count++;
+			free(line);
+			line = get_next_line(fd);
+		}
+	}
+	else if (input_open(&in, fd) == 0)
+	{
+		while (input_next_line(&in, NULL))
+			count++;
+		input_close(&in);
+	}
+	close(fd);
+	return (count);
+}
+
+static void	run_case(const char *name, size_t n_lines, size_t line_len)
+{
+	static const char	*readers[] = {"input_source", "get_next_line"};
+	size_t				bytes;
+	double				start;
+	double				elapsed;
+	int					use_gnl;
+
+	bytes = write_script(n_lines, line_len);
+	use_gnl = 1;
+	while (use_gnl >= 0)
+	{
+		start = now_seconds();
+		if (read_all(use_gnl) != n_lines)
+			printf("  line count mismatch!\n");
+		elapsed = now_seconds() - start;
+		printf("%-22s %-14s %12.0f lines/s %9.1f MB/s\n", name,
+			readers[use_gnl], n_lines / elapsed,
+			bytes / elapsed / (1024 * 1024));
+		fflush(stdout);
+		use_gnl--;
+	}
+	unlink(BENCH_FILE);
+}
+
+int	main(void)
+{
+	run_case("short lines (16B)", 4000, 16);
+	run_case("script lines (80B)", 100000, 80);
+	run_case("long lines (8KB)", 200, 8192);
+	return (0);
+}
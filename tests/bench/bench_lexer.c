@@ -0,0 +1,115 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_lexer.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/19 10:12:31 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/09/19 10:12:31 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "minishell.h"
+#include <time.h>
+
+/*
+** Throughput benchmark for the lexer character classification.
+** Runs each delimiter scanner over one long line of word characters, then
+** lexes a command line with thousands of long arguments end to end.
+*/
+
+#define SCAN_BYTES 4194304
+#define SCAN_ROUNDS 64
+#define ARG_COUNT 4000
+#define ARG_LEN 200
+
+static double	now_seconds(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec + ts.tv_nsec / 1e9);
+}
+
+static char	*build_line(size_t words, size_t word_len)
+{
+	char	*line;
+	size_t	i;
+
+	line = malloc(words * (word_len + 1) + 1);
+	if (!line)
+		return (NULL);
+	i = 0;
+	while (i < words * (word_len + 1))
+	{
+		line[i] = 'a' + i % 26;
+		if (i % (word_len + 1) == word_len)
+			line[i] = ' ';
+		i++;
+	}
+	line[i] = '\0';
+	return (line);
+}
+
+static void	bench_scanner(const char *name, t_scan_fn scan, const char *line)
+{
+	double	start;
+	double	elapsed;
+	size_t	round;
+	size_t	sink;
+
+	sink = 0;
+	start = now_seconds();
+	round = 0;
+	while (round++ < SCAN_ROUNDS)
+		sink += scan(line, round & 1, SCAN_BYTES);
+	elapsed = now_seconds() - start;
+	printf("  %-8s %10.1f MB/s  (end %zu)\n", name,
+		SCAN_BYTES * (double)SCAN_ROUNDS / elapsed / 1e6,
+		sink / SCAN_ROUNDS);
+}
+
+static void	bench_lex(const char *line, size_t len)
+{
+	t_lexer	*lexer;
+	t_token	*token;
+	double	start;
+	double	elapsed;
+	size_t	count;
+
+	count = 0;
+	start = now_seconds();
+	lexer = lexer_init(line);
+	token = lexer_next_token(lexer);
+	while (token && token->type != TOKEN_EOF)
+	{
+		count++;
+		token = lexer_next_token(lexer);
+	}
+	lexer_destroy(lexer);
+	elapsed = now_seconds() - start;
+	printf("  lex %d args x %dB: %zu tokens, %.1f MB/s\n",
+		ARG_COUNT, ARG_LEN, count, len / elapsed / 1e6);
+}
+
+int	main(void)
+{
+	char	*flat;
+	char	*args;
+
+	flat = build_line(1, SCAN_BYTES);
+	args = build_line(ARG_COUNT, ARG_LEN);
+	if (!flat || !args)
+		return (1);
+	printf("lexer scan (dispatch: %s)\n", lexer_scan_name());
+	bench_scanner("scalar", lexer_scan_scalar, flat);
+	bench_scanner("sse2", lexer_scan_sse2, flat);
+	if (lexer_scan_best() == lexer_scan_avx2)
+		bench_scanner("avx2", lexer_scan_avx2, flat);
+	bench_lex(args, ft_strlen(args));
+	free(flat);
+	free(args);
+	return (0);
+}
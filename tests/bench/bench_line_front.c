@@ -0,0 +1,131 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_line_front.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/20 14:22:10 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/09/20 14:22:10 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "minishell.h"
+#include <time.h>
+
+/*
+** Front-end benchmark on 1 MB single-line inputs.
+** "legacy" replays the old pipeline: a quote pre-scan, the copy made by
+** process_quotes and the copy made by lexer_init, then lexing. "fused"
+** lexes the line in place and lets the lexer report unclosed quotes.
+*/
+
+#define LINE_BYTES 1048576
+#define ROUNDS 20
+
+static char	*build_line(const char *word)
+{
+	char	*line;
+	size_t	pos;
+	size_t	wlen;
+
+	line = malloc(LINE_BYTES + 1);
+	if (!line)
+		return (NULL);
+	wlen = ft_strlen(word);
+	pos = 0;
+	while (pos + wlen <= LINE_BYTES)
+	{
+		memcpy(line + pos, word, wlen);
+		pos += wlen;
+	}
+	line[pos] = '\0';
+	return (line);
+}
+
+static int	legacy_unclosed(const char *str)
+{
+	int	i;
+	int	in_single;
+	int	in_double;
+
+	i = 0;
+	in_single = 0;
+	in_double = 0;
+	while (str[i])
+	{
+		if (str[i] == '\'' && !in_double)
+			in_single = !in_single;
+		else if (str[i] == '"' && !in_single)
+			in_double = !in_double;
+		i++;
+	}
+	return (in_single || in_double);
+}
+
+static size_t	front_end(const char *line, int legacy)
+{
+	t_lexer	*lexer;
+	t_token	*token;
+	char	*copies[2];
+	size_t	count;
+
+	copies[0] = NULL;
+	copies[1] = NULL;
+	if (legacy && legacy_unclosed(line))
+		return (0);
+	if (legacy)
+		copies[0] = ft_strdup(line);
+	if (legacy)
+		copies[1] = ft_strdup(copies[0]);
+	if (legacy)
+		line = copies[1];
+	lexer = lexer_init(line);
+	count = 0;
+	token = lexer_next_token(lexer);
+	while (token && token->type != TOKEN_EOF && token->type != TOKEN_ERROR)
+	{
+		count++;
+		token = lexer_next_token(lexer);
+	}
+	lexer_destroy(lexer);
+	free(copies[0]);
+	return (free(copies[1]), count);
+}
+
+static double	megabytes_per_second(const char *line, int legacy)
+{
+	struct timespec	start;
+	struct timespec	end;
+	int				round;
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	round = 0;
+	while (round++ < ROUNDS)
+		front_end(line, legacy);
+	clock_gettime(CLOCK_MONOTONIC, &end);
+	return (ROUNDS / ((end.tv_sec - start.tv_sec)
+			+ (end.tv_nsec - start.tv_nsec) / 1e9));
+}
+
+int	main(void)
+{
+	const char	*words[3] = {"argument ", "'single q' \"dbl $HOME\" ",
+		"abcdefghijklmnopqrstuvwxyz0123456789abcdefghijklmnopqrstuvwxy "};
+	char		*line;
+	int			w;
+
+	printf("%-14s %10s %12s %12s\n", "1MB line", "tokens", "legacy",
+		"fused");
+	w = -1;
+	while (++w < 3)
+	{
+		line = build_line(words[w]);
+		printf("words of %-5zu %10zu %9.1f MB/s %7.1f MB/s\n",
+			ft_strlen(words[w]), front_end(line, 0),
+			megabytes_per_second(line, 1), megabytes_per_second(line, 0));
+		free(line);
+	}
+	return (0);
+}
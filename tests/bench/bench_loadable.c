@@ -0,0 +1,117 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_loadable.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/10/04 15:08:22 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/10/04 15:08:22 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+#include <time.h>
+
+/*
+** Benchmark for loadable builtins. Runs basename and cat (on the Makefile)
+** as programs, through fork + execve and through execute_single_command
+** (posix_spawn), then as builtins loaded from the sample shared object
+** (argv[1], obj/loadables/utils.so by default), and reports the time per
+** invocation of each. Their output goes to /dev/null.
+*/
+
+#define RUNS 500
+
+static double	now_seconds(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec + ts.tv_nsec / 1e9);
+}
+
+static double	bench_fork(t_cmd *cmd, t_shell *sh)
+{
+	double	start;
+	pid_t	pid;
+	size_t	i;
+
+	start = now_seconds();
+	i = 0;
+	while (i++ < RUNS)
+	{
+		pid = fork_command(cmd, sh);
+		if (pid == 0)
+		{
+			execve(cmd->path, cmd->argv, env_envp(&sh->env));
+			_exit(127);
+		}
+		waitpid(pid, NULL, 0);
+	}
+	return ((now_seconds() - start) * 1e6 / RUNS);
+}
+
+static double	bench_shell(t_cmd *cmd, t_shell *sh)
+{
+	double	start;
+	size_t	i;
+
+	start = now_seconds();
+	i = 0;
+	while (i++ < RUNS)
+		execute_single_command(cmd, sh);
+	return ((now_seconds() - start) * 1e6 / RUNS);
+}
+
+static void	bench_utility(t_shell *sh, char **argv, int out)
+{
+	t_cmd	cmd;
+	double	fork_us;
+	double	spawn_us;
+	double	loaded_us;
+
+	ft_bzero(&cmd, sizeof(cmd));
+	cmd.argv = argv;
+	cmd.path = find_command_path(argv[0], sh);
+	if (!cmd.path)
+		return ;
+	fork_us = bench_fork(&cmd, sh);
+	spawn_us = bench_shell(&cmd, sh);
+	free(cmd.path);
+	cmd.path = NULL;
+	cmd.builtin = BUILTIN_LOADABLE;
+	cmd.loadable = loadable_find(&sh->loadables, argv[0]);
+	loaded_us = bench_shell(&cmd, sh);
+	dprintf(out, "  %-8s fork+exec %7.1f, spawn %7.1f, loaded %6.2f"
+		" (%.0fx)\n", argv[0], fork_us, spawn_us, loaded_us,
+		spawn_us / loaded_us);
+}
+
+int	main(int argc, char **argv, char **envp)
+{
+	t_shell		sh;
+	const char	*so;
+	int			out;
+	int			null;
+
+	so = "obj/loadables/utils.so";
+	if (argc > 1)
+		so = argv[1];
+	ft_bzero(&sh, sizeof(sh));
+	out_init(&sh.out, STDOUT_FILENO);
+	if (env_init(&sh.env, envp) || loadable_open(&sh, so, "basename")
+		|| loadable_open(&sh, so, "cat"))
+		return (1);
+	out = dup(STDOUT_FILENO);
+	null = open("/dev/null", O_WRONLY);
+	if (out < 0 || null < 0 || dup2(null, STDOUT_FILENO) < 0)
+		return (1);
+	dprintf(out, "per invocation (%d runs, microseconds)\n", RUNS);
+	bench_utility(&sh, (char *[]){"basename", "/usr/lib/libc.so", ".so",
+		NULL}, out);
+	bench_utility(&sh, (char *[]){"cat", "Makefile", NULL}, out);
+	loadable_clear(&sh.loadables);
+	env_destroy(&sh.env);
+	return (0);
+}
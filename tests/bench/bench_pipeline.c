@@ -0,0 +1,108 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_pipeline.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/10/05 14:20:36 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/10/05 14:20:36 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+#include <time.h>
+
+/*
+** Benchmark for builtin pipeline stages. Runs "echo x | cat" and
+** "echo x | echo y" through execute_pipeline with the first echo as the
+** builtin and as /bin/echo, which is spawned, and reports the time per
+** pipeline and the processes each one started. Only the last builtin of
+** a pipeline runs inside the shell: in "echo x | cat" that is the first
+** echo, in "echo x | echo y" it is echo y, so there the first echo is
+** forked and the shape compares a fork with a spawn. Their output goes
+** to /dev/null.
+*/
+
+#define RUNS 500
+
+static double	now_seconds(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec + ts.tv_nsec / 1e9);
+}
+
+static void	stage(t_cmd *cmd, char **argv, t_cmd *next, t_shell *sh)
+{
+	ft_bzero(cmd, sizeof(*cmd));
+	cmd->argv = argv;
+	cmd->builtin = builtin_lookup(argv[0]);
+	if (!cmd->builtin)
+		cmd->path = find_command_path(argv[0], sh);
+	cmd->stage_in = -1;
+	cmd->stage_out = -1;
+	cmd->next = next;
+	if (next)
+		next->prev = cmd;
+}
+
+static double	bench_pipeline(t_cmd *first, t_shell *sh, size_t *procs)
+{
+	double	start;
+	size_t	i;
+
+	sh->forks = 0;
+	sh->spawns = 0;
+	sh->current_cmd_list = first;
+	start = now_seconds();
+	i = 0;
+	while (i++ < RUNS)
+		execute_pipeline(first, sh);
+	*procs = (sh->forks + sh->spawns) / RUNS;
+	return ((now_seconds() - start) * 1e6 / RUNS);
+}
+
+static void	bench_shape(t_shell *sh, char **second, int out)
+{
+	t_cmd	cmds[2];
+	double	builtin_us;
+	double	program_us;
+	size_t	builtin_procs;
+	size_t	program_procs;
+
+	stage(&cmds[1], second, NULL, sh);
+	stage(&cmds[0], (char *[]){"echo", "x", NULL}, &cmds[1], sh);
+	builtin_us = bench_pipeline(&cmds[0], sh, &builtin_procs);
+	stage(&cmds[0], (char *[]){"/bin/echo", "x", NULL}, &cmds[1], sh);
+	program_us = bench_pipeline(&cmds[0], sh, &program_procs);
+	dprintf(out, "  echo x | %-6s builtin %7.1f (%zu started), "
+		"/bin/echo %7.1f (%zu started)\n", second[0], builtin_us,
+		builtin_procs, program_us, program_procs);
+	free(cmds[0].path);
+	free(cmds[1].path);
+}
+
+int	main(int argc, char **argv, char **envp)
+{
+	t_shell	sh;
+	int		out;
+	int		null;
+
+	(void)argc;
+	(void)argv;
+	ft_bzero(&sh, sizeof(sh));
+	out_init(&sh.out, STDOUT_FILENO);
+	if (env_init(&sh.env, envp))
+		return (1);
+	out = dup(STDOUT_FILENO);
+	null = open("/dev/null", O_WRONLY);
+	if (out < 0 || null < 0 || dup2(null, STDOUT_FILENO) < 0)
+		return (1);
+	dprintf(out, "per pipeline (%d runs, microseconds)\n", RUNS);
+	bench_shape(&sh, (char *[]){"cat", NULL}, out);
+	bench_shape(&sh, (char *[]){"echo", "y", NULL}, out);
+	env_destroy(&sh.env);
+	return (0);
+}
@@ -0,0 +1,110 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_spawn.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/29 10:58:36 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/09/29 10:58:36 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "minishell.h"
+#include <time.h>
+
+/*
+** Benchmark for launching external commands from a large shell. Grows the
+** parent heap, touching every page as readline history and a long session
+** would, then runs /bin/true through fork + execve and through
+** spawn_command, and reports launches per second for each. The heap is
+** read back when printing so that the compiler cannot drop it.
+*/
+
+#define HEAP_SIZES 4
+#define LAUNCHES 300
+
+static double	now_seconds(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec + ts.tv_nsec / 1e9);
+}
+
+static double	bench_fork(t_cmd *cmd, t_shell *sh)
+{
+	double	start;
+	pid_t	pid;
+	size_t	i;
+
+	start = now_seconds();
+	i = 0;
+	while (i++ < LAUNCHES)
+	{
+		pid = fork_command(cmd, sh);
+		if (pid == 0)
+		{
+			execve(cmd->path, cmd->argv, env_envp(&sh->env));
+			_exit(127);
+		}
+		waitpid(pid, NULL, 0);
+	}
+	return (LAUNCHES / (now_seconds() - start));
+}
+
+static double	bench_spawn(t_cmd *cmd, t_shell *sh)
+{
+	int		no_pipe[2];
+	double	start;
+	pid_t	pid;
+	size_t	i;
+
+	no_pipe[0] = -1;
+	no_pipe[1] = -1;
+	start = now_seconds();
+	i = 0;
+	while (i++ < LAUNCHES)
+	{
+		pid = spawn_command(cmd, no_pipe, -1, sh);
+		if (pid < 0)
+			return (0);
+		waitpid(pid, NULL, 0);
+	}
+	return (LAUNCHES / (now_seconds() - start));
+}
+
+int	main(int argc, char **argv, char **envp)
+{
+	static const size_t	sizes[HEAP_SIZES] = {0, 64, 256, 1024};
+	t_shell				sh;
+	t_cmd				cmd;
+	char				*heap;
+	size_t				i;
+
+	(void)argc;
+	(void)argv;
+	ft_bzero(&sh, sizeof(sh));
+	ft_bzero(&cmd, sizeof(cmd));
+	cmd.argv = (char *[]){"true", NULL};
+	cmd.path = "/bin/true";
+	if (env_init(&sh.env, envp) || access(cmd.path, X_OK))
+		return (1);
+	printf("launch /bin/true (%d runs, launches/s)\n", LAUNCHES);
+	i = 0;
+	while (i < HEAP_SIZES)
+	{
+		heap = malloc(sizes[i] << 20 | 1);
+		if (!heap)
+			return (1);
+		memset(heap, 1, sizes[i] << 20 | 1);
+		printf("  %4zu MB heap: fork %7.0f, spawn %7.0f\n", sizes[i]
+			* heap[sizes[i] << 19], bench_fork(&cmd, &sh),
+			bench_spawn(&cmd, &sh));
+		free(heap);
+		i++;
+	}
+	env_destroy(&sh.env);
+	return (0);
+}
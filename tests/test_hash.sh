@@ -0,0 +1,125 @@
+#!/bin/bash
+
+# Command Hash Test Script
+# Tests: external commands are hashed on first use, the hash and type
+# builtins, and PATH changes emptying the table
+
+MINISHELL="./minishell"
+
+# Colors for output
+RED='\033[0;31m'
+GREEN='\033[0;32m'
+YELLOW='\033[1;33m'
+NC='\033[0m' # No Color
+
+# Test counter
+TESTS_PASSED=0
+TESTS_FAILED=0
+
+# Helper functions
+log_test() {
+    echo -e "${YELLOW}[TEST]${NC} $1"
+}
+
+log_pass() {
+    echo -e "${GREEN}[PASS]${NC} $1"
+    ((TESTS_PASSED++))
+}
+
+log_fail() {
+    echo -e "${RED}[FAIL]${NC} $1"
+    ((TESTS_FAILED++))
+}
+
+# Feed a script to minishell and compare stdout and exit status
+expect() {
+    local name="$1"
+    local expected_out="$2"
+    local expected_rc="$3"
+    local script="$4"
+
+    local out
+    out=$(printf '%s\n' "$script" | timeout 5s "$MINISHELL" 2>/dev/null)
+    local rc=$?
+    if [ "$out" = "$expected_out" ] && [ "$rc" = "$expected_rc" ]; then
+        log_pass "$name"
+    else
+        log_fail "$name (got '$out' rc=$rc, expected '$expected_out' rc=$expected_rc)"
+    fi
+}
+
+test_hashing() {
+    log_test "Testing command hashing..."
+    expect "Table starts empty" "hash: hash table empty" 0 "hash"
+    expect "Commands are hashed with their hits" \
+        "$(printf 'hits\tcommand\n   2\t%s' "$(type -P true)")" 0 \
+        "$(printf 'true\ntrue\nhash')"
+    expect "Builtins and paths are not hashed" "hash: hash table empty" 0 \
+        "$(printf 'echo -n\n%s\nhash' "$(type -P true)")"
+    expect "Pipeline stages are hashed by the shell" \
+        "$(printf 'a\nhits\tcommand\n   2\t%s' "$(type -P cat)")" 0 \
+        "$(printf 'echo a | cat | cat\nhash')"
+    expect "hash -r empties the table" "hash: hash table empty" 0 \
+        "$(printf 'true\nhash -r\nhash')"
+    expect "hash name adds it with no hits" \
+        "$(printf 'hits\tcommand\n   0\t%s' "$(type -P true)")" 0 \
+        "$(printf 'hash true\nhash')"
+    expect "hash of an unknown name fails" "1" 0 \
+        "$(printf 'hash no-such-cmd\necho $?')"
+    expect "Bad option prints usage" "2" 0 "$(printf 'hash -x\necho $?')"
+}
+
+test_path_changes() {
+    log_test "Testing PATH changes..."
+    expect "export PATH empties the table" "hash: hash table empty" 0 \
+        "$(printf 'true\nexport PATH=$PATH\nhash')"
+    expect "unset PATH empties the table" "127" 0 \
+        "$(printf 'true\nunset PATH\ntrue\necho $?')"
+    expect "Other variables keep it" \
+        "$(printf 'hits\tcommand\n   1\t%s' "$(type -P true)")" 0 \
+        "$(printf 'true\nexport X=1\nhash')"
+
+    local dir="/tmp/minishell_hash_$$"
+    mkdir -p "$dir/d1" "$dir/d2"
+    printf '#!/bin/sh\necho one\n' > "$dir/d1/foo"
+    printf '#!/bin/sh\necho two\n' > "$dir/d2/foo"
+    chmod +x "$dir/d1/foo" "$dir/d2/foo"
+    expect "A removed hashed program is searched again" \
+        "$(printf 'one\ntwo\n0\nhits\tcommand\n   1\t%s' "$dir/d2/foo")" 0 \
+        "$(printf 'export PATH=%s/d1:%s/d2\nfoo\n/bin/rm %s/d1/foo\nfoo\necho $?\nhash' \
+            "$dir" "$dir" "$dir")"
+    rm -rf "$dir"
+}
+
+test_type() {
+    log_test "Testing type..."
+    expect "Builtin" "echo is a shell builtin" 0 "type echo"
+    expect "Program in PATH" "true is $(type -P true)" 0 "type true"
+    expect "Hashed program" "true is hashed ($(type -P true))" 0 \
+        "$(printf 'true\ntype true')"
+    expect "type does not hash" "hash: hash table empty" 0 \
+        "$(printf 'type true > /dev/null\nhash')"
+    expect "Unknown name fails" "1" 0 "$(printf 'type no-such-cmd\necho $?')"
+}
+
+main() {
+    test_hashing
+    test_path_changes
+    test_type
+
+    echo "=========================================="
+    echo "Test Results:"
+    echo "Passed: $TESTS_PASSED"
+    echo "Failed: $TESTS_FAILED"
+    echo "Total:  $((TESTS_PASSED + TESTS_FAILED))"
+
+    if [ $TESTS_FAILED -eq 0 ]; then
+        echo -e "${GREEN}All tests passed! ✅${NC}"
+        exit 0
+    else
+        echo -e "${RED}Some tests failed! ❌${NC}"
+        exit 1
+    fi
+}
+
+main "$@"
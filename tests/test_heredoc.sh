@@ -0,0 +1,107 @@
+#!/bin/bash
+
+# Large Heredoc Test Script
+# Tests: heredoc bodies far beyond the pipe capacity (1 MB and 100 MB) reach
+# single commands and pipelines whole, expanded or not, without hanging
+
+MINISHELL="./minishell"
+
+# Colors for output
+RED='\033[0;31m'
+GREEN='\033[0;32m'
+YELLOW='\033[1;33m'
+NC='\033[0m' # No Color
+
+# Test counter
+TESTS_PASSED=0
+TESTS_FAILED=0
+
+# Helper functions
+log_test() {
+    echo -e "${YELLOW}[TEST]${NC} $1"
+}
+
+log_pass() {
+    echo -e "${GREEN}[PASS]${NC} $1"
+    ((TESTS_PASSED++))
+}
+
+log_fail() {
+    echo -e "${RED}[FAIL]${NC} $1"
+    ((TESTS_FAILED++))
+}
+
+LINE="0123456789abcdef0123456789abcdef0123456789abcdef0123456789abcde"
+
+# Run "$command << DELIM", a body of the given size in bytes, and DELIM;
+# the command must print the body size
+expect_size() {
+    local name="$1"
+    local command="$2"
+    local delim="$3"
+    local size="$4"
+
+    local out
+    out=$({ echo "$command << $delim"; yes "$LINE" | head -c "$size"
+        echo "${delim//\'/}"; echo 'echo done'; } \
+        | timeout 60s "$MINISHELL" 2>/dev/null)
+    local rc=$?
+    if [ "$out" = "$(printf '%s\ndone' "$size")" ] && [ "$rc" = 0 ]; then
+        log_pass "$name"
+    else
+        log_fail "$name (got '$out' rc=$rc, expected '$size' then 'done')"
+    fi
+}
+
+test_sizes() {
+    local size
+    for size in 1048576 104857600; do
+        log_test "Testing $size byte heredocs..."
+        expect_size "Single command" "wc -c" "EOF" "$size"
+        expect_size "Single command, quoted delimiter" "wc -c" "'EOF'" "$size"
+        expect_size "Pipeline" "cat </dev/null | wc -c" "EOF" "$size"
+        expect_size "Pipeline, heredoc on the last stage" \
+            "true | wc -c" "EOF" "$size"
+        expect_size "Three-stage pipeline" "cat </dev/null | cat | wc -c" "'EOF'" "$size"
+    done
+}
+
+test_expansion() {
+    log_test "Testing heredoc contents..."
+    local out
+    out=$(printf 'export V=v\ncat << E | cat\n$V a\nE\ncat << "E"\n$V\nE\n' \
+        | timeout 5s "$MINISHELL" 2>/dev/null)
+    if [ "$out" = "$(printf 'v a\n$V')" ]; then
+        log_pass "Bodies are expanded unless the delimiter is quoted"
+    else
+        log_fail "Bodies are expanded unless the delimiter is quoted (got '$out')"
+    fi
+    out=$(printf '%s\n' 'export V=v' 'cat << E' "\"\$V\" '\$V' \\\$V \\\\ \\\"" 'E' \
+        | timeout 5s "$MINISHELL" 2>/dev/null)
+    if [ "$out" = "\"v\" 'v' \$V \\ \\\"" ]; then
+        log_pass "Quotes are literal and backslash escapes only \$ and \\"
+    else
+        log_fail "Quotes are literal and backslash escapes only \$ and \\ (got '$out')"
+    fi
+}
+
+main() {
+    test_sizes
+    test_expansion
+
+    echo "=========================================="
+    echo "Test Results:"
+    echo "Passed: $TESTS_PASSED"
+    echo "Failed: $TESTS_FAILED"
+    echo "Total:  $((TESTS_PASSED + TESTS_FAILED))"
+
+    if [ $TESTS_FAILED -eq 0 ]; then
+        echo -e "${GREEN}All tests passed! ✅${NC}"
+        exit 0
+    else
+        echo -e "${RED}Some tests failed! ❌${NC}"
+        exit 1
+    fi
+}
+
+main "$@"
@@ -0,0 +1,111 @@
+#!/bin/bash
+
+# Command List Test Script
+# Tests: ';', '&&' and '||' lists, short-circuit evaluation, expansion at
+# execution time, list syntax errors
+
+MINISHELL="./minishell"
+
+# Colors for output
+RED='\033[0;31m'
+GREEN='\033[0;32m'
+YELLOW='\033[1;33m'
+NC='\033[0m' # No Color
+
+# Test counter
+TESTS_PASSED=0
+TESTS_FAILED=0
+
+# Helper functions
+log_test() {
+    echo -e "${YELLOW}[TEST]${NC} $1"
+}
+
+log_pass() {
+    echo -e "${GREEN}[PASS]${NC} $1"
+    ((TESTS_PASSED++))
+}
+
+log_fail() {
+    echo -e "${RED}[FAIL]${NC} $1"
+    ((TESTS_FAILED++))
+}
+
+# Feed one line to minishell and compare stdout and exit status
+expect() {
+    local name="$1"
+    local expected_out="$2"
+    local expected_rc="$3"
+    local line="$4"
+
+    local out
+    out=$(printf '%s\n' "$line" | timeout 5s "$MINISHELL" 2>/dev/null)
+    local rc=$?
+    if [ "$out" = "$expected_out" ] && [ "$rc" = "$expected_rc" ]; then
+        log_pass "$name"
+    else
+        log_fail "$name (got '$out' rc=$rc, expected '$expected_out' rc=$expected_rc)"
+    fi
+}
+
+test_sequences() {
+    log_test "Testing ';' sequences..."
+    expect "Sequence runs every command" "$(printf 'a\nb\nc')" 0 "echo a; echo b ;echo c"
+    expect "Trailing ';' is allowed" "a" 0 "echo a;"
+    expect "Status is the last command's" "" 1 "true; false"
+    expect "Pipelines inside a list" "$(printf 'a\ny')" 0 "echo a; echo x | tr x y"
+    expect "Quoted operators are words" "a;b c&&d" 0 "echo 'a;b' \"c&&d\""
+    expect "Single '&' stays in the word" "a&b" 0 "echo a&b"
+}
+
+test_short_circuit() {
+    log_test "Testing '&&' and '||'..."
+    expect "&& runs after success" "ok" 0 "true && echo ok"
+    expect "&& skips after failure" "" 1 "false && echo bad"
+    expect "|| runs after failure" "ok" 0 "false || echo ok"
+    expect "|| skips after success" "" 0 "true || echo bad"
+    expect "a && b || c after failure" "c" 0 "false && echo b || echo c"
+    expect "a || b && c after success" "c" 0 "true || echo b && echo c"
+    expect "exit stops the list" "" 4 "exit 4 && echo no; echo no"
+}
+
+test_deferred_expansion() {
+    log_test "Testing expansion at execution time..."
+    expect "\$? sees the previous command" "1" 0 "false; echo \$?"
+    expect "\$? after ||" "1" 0 "false || echo \$?"
+    expect "export is visible later in the list" "v=42" 0 "export V=42 && echo v=\$V"
+    expect "Heredoc bodies in list order" "$(printf 'one\ntwo')" 0 \
+        "$(printf 'cat << A ; cat << B\none\nA\ntwo\nB')"
+}
+
+test_syntax_errors() {
+    log_test "Testing list syntax errors..."
+    expect "Leading ';'" "" 2 "; echo a"
+    expect "Missing command after &&" "" 2 "echo a &&"
+    expect "Missing command after ||" "" 2 "echo a ||"
+    expect "Empty pipeline stage" "" 2 "echo a | | echo b"
+    expect "Nothing runs on a syntax error" "" 2 "echo a && && echo b"
+}
+
+main() {
+    test_sequences
+    test_short_circuit
+    test_deferred_expansion
+    test_syntax_errors
+
+    echo "=========================================="
+    echo "Test Results:"
+    echo "Passed: $TESTS_PASSED"
+    echo "Failed: $TESTS_FAILED"
+    echo "Total:  $((TESTS_PASSED + TESTS_FAILED))"
+
+    if [ $TESTS_FAILED -eq 0 ]; then
+        echo -e "${GREEN}All tests passed! ✅${NC}"
+        exit 0
+    else
+        echo -e "${RED}Some tests failed! ❌${NC}"
+        exit 1
+    fi
+}
+
+main "$@"
@@ -0,0 +1,141 @@
+#!/bin/bash
+
+# Loadable Builtin Test Script
+# Tests: enable -f loading the sample utilities from a shared object, the
+# utilities against their standalone versions, redirections and pipelines
+# around them, enable -d and load errors
+
+MINISHELL="$(pwd)/minishell"
+LOADABLES="$(pwd)/obj/loadables/utils.so"
+WORKDIR=$(mktemp -d)
+
+# Colors for output
+RED='\033[0;31m'
+GREEN='\033[0;32m'
+YELLOW='\033[1;33m'
+NC='\033[0m' # No Color
+
+# Test counter
+TESTS_PASSED=0
+TESTS_FAILED=0
+
+# Helper functions
+log_test() {
+    echo -e "${YELLOW}[TEST]${NC} $1"
+}
+
+log_pass() {
+    echo -e "${GREEN}[PASS]${NC} $1"
+    ((TESTS_PASSED++))
+}
+
+log_fail() {
+    echo -e "${RED}[FAIL]${NC} $1"
+    ((TESTS_FAILED++))
+}
+
+# Feed a script to minishell in a directory holding the file "f", with the
+# sample utilities loaded first, and compare stdout and exit status
+expect() {
+    local name="$1"
+    local expected_out="$2"
+    local expected_rc="$3"
+    local script="$4"
+
+    printf 'one\ntwo words\n\nfour  spaced   words\nfive\n' > "$WORKDIR/f"
+    local out
+    out=$(cd "$WORKDIR" && printf 'enable -f %s basename cat head sleep wc\n%s\n' \
+        "$LOADABLES" "$script" | timeout 5s "$MINISHELL" 2>/dev/null)
+    local rc=$?
+    if [ "$out" = "$expected_out" ] && [ "$rc" = "$expected_rc" ]; then
+        log_pass "$name"
+    else
+        log_fail "$name (got '$out' rc=$rc, expected '$expected_out' rc=$expected_rc)"
+    fi
+    find "$WORKDIR" -mindepth 1 -delete
+}
+
+# Same, with the output of the standalone utility as the expectation
+expect_same() {
+    local name="$1"
+    local command="$2"
+
+    printf 'one\ntwo words\n\nfour  spaced   words\nfive\n' > "$WORKDIR/f"
+    local expected
+    expected=$(cd "$WORKDIR" && eval "$command")
+    expect "$name" "$expected" 0 "$command"
+}
+
+test_enable() {
+    log_test "Testing enable..."
+    expect "Loaded names are builtins" "cat is a shell builtin" 0 "type cat"
+    expect "Listed after the shell's own" "$(printf 'enable sleep\nenable wc')" 0 \
+        "enable | tail -n 2"
+    expect "Loaded builtins are not hashed" "hash: hash table empty" 0 \
+        "$(printf 'cat f >/dev/null\nhash')"
+    expect "enable -d falls back to the program" \
+        "$(printf 'one\nhits\tcommand\n   1\t%s' "$(type -P head)")" 0 \
+        "$(printf 'enable -d head\nhead -n 1 f\nhash')"
+    expect "enable -d of a name not loaded" "1" 0 \
+        "$(printf 'enable -d ls\necho $?')"
+    expect "Shell builtins cannot be replaced" "1" 0 \
+        "$(printf 'enable -f %s echo\necho $?' "$LOADABLES")"
+    expect "Missing shared object" "1" 0 \
+        "$(printf 'enable -f ./none.so cat\necho $?')"
+    expect "Missing builtin in the shared object" "1" 0 \
+        "$(printf 'enable -f %s ls\necho $?' "$LOADABLES")"
+}
+
+test_utilities() {
+    log_test "Testing the sample utilities..."
+    expect_same "cat" "cat f"
+    expect_same "cat - and files" "cat f - f < f"
+    expect_same "head -n" "head -n 2 f"
+    expect_same "head -N of several files" "head -2 f f"
+    expect_same "wc" "wc f"
+    expect_same "wc -l" "wc -l f"
+    expect_same "wc of several files" "wc -lw f f"
+    expect_same "wc of stdin" "wc < f"
+    expect_same "basename" "basename /usr/lib/libc.so .so"
+    expect_same "basename of /" "basename /"
+    expect_same "basename with trailing slashes" "basename a/b//"
+    expect "sleep" "0" 0 "$(printf 'sleep 0.05\necho $?')"
+    expect "Errors set the status" "$(printf '1\n1\n1\n1')" 0 \
+        "$(printf 'cat none\necho $?\nhead -n x f\necho $?\nwc -x\necho $?\nsleep x\necho $?')"
+    expect "Errors are the utility's own" "cat: none: No such file or directory" 1 \
+        "cat none 2>&1"
+}
+
+test_shell() {
+    log_test "Testing redirections and pipelines..."
+    expect "Output redirection is restored" "$(printf 'after\n5')" 0 \
+        "$(printf 'cat f >g\necho after\nwc -l <g')"
+    expect "Input redirection is restored" "$(printf '1\nstill here')" 0 \
+        "$(printf 'head -n 1 <f | wc -l\necho still here')"
+    expect "Pipeline stages" "2" 0 "cat f | head -n 2 | wc -l"
+    expect "Between external commands" "3" 0 "printf 'a\nb\nc\n' | cat | tr -d x | wc -l"
+}
+
+main() {
+    [ -f "$LOADABLES" ] || make -s loadables >/dev/null
+    test_enable
+    test_utilities
+    test_shell
+    rmdir "$WORKDIR"
+
+    echo "=========================================="
+    echo "Test Results:"
+    echo "Passed: $TESTS_PASSED"
+    echo "Failed: $TESTS_FAILED"
+    echo "Total:  $((TESTS_PASSED + TESTS_FAILED))"
+
+    if [ $TESTS_FAILED -eq 0 ]; then
+        echo -e "${GREEN}All tests passed! ✅${NC}"
+        exit 0
+    else
+        echo -e "${RED}Some tests failed! ❌${NC}"
+        exit 1
+    fi
+}
+
+main "$@"
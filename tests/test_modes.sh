@@ -0,0 +1,129 @@
+#!/bin/bash
+
+# Invocation Modes Test Script
+# Tests: -c command strings, script files, positional parameters, exec-in-place
+
+MINISHELL="./minishell"
+TEMP_DIR="/tmp/minishell_modes_$$"
+
+# Colors for output
+RED='\033[0;31m'
+GREEN='\033[0;32m'
+YELLOW='\033[1;33m'
+NC='\033[0m' # No Color
+
+# Test counter
+TESTS_PASSED=0
+TESTS_FAILED=0
+
+# Helper functions
+log_test() {
+    echo -e "${YELLOW}[TEST]${NC} $1"
+}
+
+log_pass() {
+    echo -e "${GREEN}[PASS]${NC} $1"
+    ((TESTS_PASSED++))
+}
+
+log_fail() {
+    echo -e "${RED}[FAIL]${NC} $1"
+    ((TESTS_FAILED++))
+}
+
+# Compare output and exit status of a minishell invocation
+expect() {
+    local name="$1"
+    local expected_out="$2"
+    local expected_rc="$3"
+    shift 3
+
+    local out
+    out=$(timeout 5s "$MINISHELL" "$@" 2>/dev/null)
+    local rc=$?
+    if [ "$out" = "$expected_out" ] && [ "$rc" = "$expected_rc" ]; then
+        log_pass "$name"
+    else
+        log_fail "$name (got '$out' rc=$rc, expected '$expected_out' rc=$expected_rc)"
+    fi
+}
+
+test_command_string() {
+    log_test "Testing -c mode..."
+    expect "-c runs the command" "hello" 0 -c "echo hello"
+    expect "-c runs every line" "$(printf 'a\nb')" 0 -c "$(printf 'echo a\necho b')"
+    expect "-c sets \$0 and \$1" "name x" 0 -c 'echo $0 $1' name x
+    expect "-c braced and two-digit positionals" "a j a0" 0 \
+        -c 'echo ${1} ${10} $10' n a b c d e f g h i j
+    expect "-c \$# \$@ \$*" "2 [a b] [a b]" 0 -c 'echo $# "[$@]" [$*]' n a b
+    expect "-c \${#} without arguments" "0 []" 0 -c 'echo ${#} [$@]'
+    expect "-c unset positional is empty" "[]" 0 -c 'echo [$3${12}]' n a
+    expect "-c exit status" "" 7 -c "exit 7"
+    expect "-c last external status" "" 1 -c "false"
+    expect "-c without argument" "" 2 -c
+    expect "-c heredoc body from string" "body" 0 -c "$(printf 'cat << EOF\nbody\nEOF')"
+}
+
+test_exec_in_place() {
+    log_test "Testing last-command exec optimization..."
+    local out
+    out=$(timeout 5s "$MINISHELL" -c 'sh -c "echo \$PPID"' 2>/dev/null & echo "$!"; wait)
+    local child_parent
+    local shell_pid
+    child_parent=$(echo "$out" | sed -n 1p)
+    shell_pid=$(echo "$out" | sed -n 2p)
+    # timeout is the parent of minishell, so with exec-in-place the
+    # child's parent is timeout rather than a forked minishell
+    if [ -n "$child_parent" ] && [ "$child_parent" = "$shell_pid" ]; then
+        log_pass "Last external command replaces the shell process"
+    else
+        log_fail "Last external command was forked ($child_parent vs $shell_pid)"
+    fi
+    out=$(timeout 5s "$MINISHELL" -c $'sh -c "echo \\$PPID"\n \t\n\n' 2>/dev/null \
+        & echo "$!"; wait)
+    child_parent=$(echo "$out" | sed -n 1p)
+    shell_pid=$(echo "$out" | sed -n 2p)
+    if [ -n "$child_parent" ] && [ "$child_parent" = "$shell_pid" ]; then
+        log_pass "Trailing blank lines do not prevent exec-in-place"
+    else
+        log_fail "Command before trailing blank lines was forked ($child_parent vs $shell_pid)"
+    fi
+}
+
+test_script_file() {
+    log_test "Testing script file mode..."
+    printf 'echo script $1 $2\nexit 3\n' > "$TEMP_DIR/script.sh"
+    expect "Script runs with arguments" "script a b" 3 "$TEMP_DIR/script.sh" a b
+    printf 'cat << END\nline\nEND\necho after\n' > "$TEMP_DIR/heredoc.sh"
+    expect "Script heredoc reads from the script" "$(printf 'line\nafter')" 0 \
+        "$TEMP_DIR/heredoc.sh"
+    printf 'echo $# $@\n' > "$TEMP_DIR/count.sh"
+    expect "Script \$# and \$@" "3 a b c" 0 "$TEMP_DIR/count.sh" a b c
+    expect "Missing script" "" 127 "$TEMP_DIR/missing.sh"
+}
+
+main() {
+    mkdir -p "$TEMP_DIR"
+
+    test_command_string
+    test_exec_in_place
+    test_script_file
+
+    rm -rf "$TEMP_DIR"
+
+    echo "=========================================="
+    echo "Test Results:"
+    echo "Passed: $TESTS_PASSED"
+    echo "Failed: $TESTS_FAILED"
+    echo "Total:  $((TESTS_PASSED + TESTS_FAILED))"
+
+    if [ $TESTS_FAILED -eq 0 ]; then
+        echo -e "${GREEN}All tests passed! ✅${NC}"
+        exit 0
+    else
+        echo -e "${RED}Some tests failed! ❌${NC}"
+        exit 1
+    fi
+}
+
+main "$@"
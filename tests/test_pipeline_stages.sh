@@ -0,0 +1,173 @@
+#!/bin/bash
+
+# Pipeline Stage Test Script
+# Tests: the last builtin stage of a pipeline runs inside the shell without
+# a fork, its output, redirections and exit statuses match a child's,
+# builtins that change the shell keep subshell semantics, and large outputs
+# or readers that exit early neither block nor kill the shell
+#
+# Only one stage per pipeline runs in the shell, by design: the last
+# builtin that qualifies, final stage or not. Builtins before it are forked
+
+MINISHELL="$(pwd)/minishell"
+LOADABLES="$(pwd)/obj/loadables/utils.so"
+BIG=$(head -c 100000 /dev/zero | tr '\0' a)
+export BIG
+
+# Colors for output
+RED='\033[0;31m'
+GREEN='\033[0;32m'
+YELLOW='\033[1;33m'
+NC='\033[0m' # No Color
+
+# Test counter
+TESTS_PASSED=0
+TESTS_FAILED=0
+
+# Helper functions
+log_test() {
+    echo -e "${YELLOW}[TEST]${NC} $1"
+}
+
+log_pass() {
+    echo -e "${GREEN}[PASS]${NC} $1"
+    ((TESTS_PASSED++))
+}
+
+log_fail() {
+    echo -e "${RED}[FAIL]${NC} $1"
+    ((TESTS_FAILED++))
+}
+
+# Feed a script to minishell and compare stdout and exit status
+expect() {
+    local name="$1"
+    local expected_out="$2"
+    local expected_rc="$3"
+    local script="$4"
+
+    local out
+    out=$(printf '%s\n' "$script" | timeout 5s "$MINISHELL" 2>/dev/null)
+    local rc=$?
+    if [ "$out" = "$expected_out" ] && [ "$rc" = "$expected_rc" ]; then
+        log_pass "$name"
+    else
+        log_fail "$name (got '$out' rc=$rc, expected '$expected_out' rc=$expected_rc)"
+    fi
+}
+
+# Run a script after stats -r and compare the processes it started
+expect_procs() {
+    local name="$1"
+    local forked="$2"
+    local spawned="$3"
+    local script="$4"
+
+    local out
+    out=$(printf 'stats -r >/dev/null\n%s\nstats\n' "$script" \
+        | timeout 5s "$MINISHELL" 2>/dev/null | tail -n 1)
+    if [ "$out" = "processes: forked $forked, spawned $spawned" ]; then
+        log_pass "$name"
+    else
+        log_fail "$name (got '$out', expected forked $forked, spawned $spawned)"
+    fi
+}
+
+test_output() {
+    log_test "Testing builtin stage output..."
+    expect "echo into a program" "a" 0 "echo a | cat"
+    expect "Builtin into builtin" "x" 0 "echo hi | echo x"
+    expect "pwd and type" "$(printf '%s\necho is a shell builtin' "$(pwd)")" 0 \
+        "$(printf 'pwd | cat\ntype echo | cat')"
+    expect "env" "1" 0 "env | grep -c ^BIG="
+    expect "Redirections override the pipe" "0" 0 "echo hi >/dev/null | wc -c"
+    expect "2>&1 is the pipe" "1" 0 "type nosuch 2>&1 | wc -l"
+    expect "The shell's fds are restored" "$(printf 'a\nafter')" 0 \
+        "$(printf 'echo a | cat\necho after')"
+}
+
+test_status() {
+    log_test "Testing stage exit statuses..."
+    expect "Last stage forked" "1" 0 "$(printf 'echo a | false\necho $?')"
+    expect "Last stage in the shell" "$(printf 'y\n0')" 0 \
+        "$(printf 'false | echo y\necho $?')"
+    expect "Failing builtin stage" "1" 0 \
+        "$(printf 'true | type nosuch\necho $?')"
+    expect "Command not found before a builtin" "$(printf 'b\n0')" 0 \
+        "$(printf 'nosuch | echo b\necho $?')"
+    expect "Command not found after a builtin" "127" 0 \
+        "$(printf 'echo a | nosuch\necho $?')"
+    expect "Builtin writer before an in-shell stage" "$(printf 'yo\n0 0')" 0 \
+        "$(printf 'echo hi | echo yo\necho $PIPESTATUS')"
+    expect "Builtin writer under pipefail" "$(printf 'yo\nok')" 0 \
+        "$(printf 'set -o pipefail\necho hi | echo yo && echo ok || echo FAILED')"
+    expect "Program between builtins" "$(printf '%s\n0 0 0' "$(pwd)")" 0 \
+        "$(printf 'echo x | cat | pwd\necho $PIPESTATUS')"
+}
+
+test_subshell() {
+    log_test "Testing builtins that change the shell..."
+    expect "cd in a pipeline" "$(pwd)" 0 "$(printf 'cd / | true\npwd')"
+    expect "export in a pipeline" "A=" 0 "$(printf 'export A=1 | true\necho A=$A')"
+    expect "exit in a pipeline" "$(printf 'x\nstill here')" 0 \
+        "$(printf 'exit 3 | echo x\necho still here')"
+}
+
+test_processes() {
+    log_test "Testing processes started..."
+    expect_procs "Builtin stages are not forked" 0 1 "echo a | cat >/dev/null"
+    expect_procs "Only the last builtin stage runs in the shell" 2 0 \
+        "echo a | echo b | echo c >/dev/null"
+    expect_procs "cd is still forked" 1 0 "cd / | echo b >/dev/null"
+    expect_procs "Programs are spawned" 0 2 "true | true"
+}
+
+test_blocking() {
+    log_test "Testing large outputs and early readers..."
+    expect "Writer ahead of a stage that does not read" "hi" 0 "echo \$BIG | echo hi"
+    expect "Reader gone" "$(printf 'alive\n0')" 0 \
+        "$(printf 'echo $BIG | true\necho alive\necho $?')"
+    expect "Output larger than a pipe" "100001" 0 "echo \$BIG | wc -c"
+    expect "Reader exits early" "aaa" 0 "echo \$BIG | head -c 3"
+}
+
+test_loadable() {
+    log_test "Testing loaded builtins as stages..."
+    local enable="enable -f $LOADABLES cat head wc"
+    expect "A reading stage runs in the shell" "$(printf 'y\ny')" 0 \
+        "$(printf '%s\nyes | head -n 2' "$enable")"
+    expect_procs "Only the program is started" 0 1 \
+        "$(printf '%s\nyes | head -n 2 >/dev/null' "$enable")"
+    expect "Only the last loaded stage runs in the shell" "100001" 0 \
+        "$(printf '%s\necho $BIG | cat | wc -c' "$enable")"
+    expect_procs "Forked reading stages" 2 0 \
+        "$(printf '%s\necho $BIG | cat | wc -c >/dev/null' "$enable")"
+    expect "Broken pipe in a loaded stage" "$(printf 'y\n0')" 0 \
+        "$(printf '%s\nyes | cat | head -n 1\necho $?' "$enable")"
+}
+
+main() {
+    [ -f "$LOADABLES" ] || make -s loadables >/dev/null
+    test_output
+    test_status
+    test_subshell
+    test_processes
+    test_blocking
+    test_loadable
+
+    echo "=========================================="
+    echo "Test Results:"
+    echo "Passed: $TESTS_PASSED"
+    echo "Failed: $TESTS_FAILED"
+    echo "Total:  $((TESTS_PASSED + TESTS_FAILED))"
+
+    if [ $TESTS_FAILED -eq 0 ]; then
+        echo -e "${GREEN}All tests passed! ✅${NC}"
+        exit 0
+    else
+        echo -e "${RED}Some tests failed! ❌${NC}"
+        exit 1
+    fi
+}
+
+main "$@"
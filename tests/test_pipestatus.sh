@@ -0,0 +1,180 @@
+#!/bin/bash
+
+# Pipeline Status Test Script
+# Tests: $PIPESTATUS holds the status of every stage of the last pipeline,
+# set -o pipefail makes a pipeline fail when any stage fails, and stats -p
+# reports the pid, status, times and memory of each stage
+
+MINISHELL="$(pwd)/minishell"
+
+# Colors for output
+RED='\033[0;31m'
+GREEN='\033[0;32m'
+YELLOW='\033[1;33m'
+NC='\033[0m' # No Color
+
+# Test counter
+TESTS_PASSED=0
+TESTS_FAILED=0
+
+# Helper functions
+log_test() {
+    echo -e "${YELLOW}[TEST]${NC} $1"
+}
+
+log_pass() {
+    echo -e "${GREEN}[PASS]${NC} $1"
+    ((TESTS_PASSED++))
+}
+
+log_fail() {
+    echo -e "${RED}[FAIL]${NC} $1"
+    ((TESTS_FAILED++))
+}
+
+# Feed a script to minishell and compare stdout and exit status
+expect() {
+    local name="$1"
+    local expected_out="$2"
+    local expected_rc="$3"
+    local script="$4"
+
+    local out
+    out=$(printf '%s\n' "$script" | timeout 5s "$MINISHELL" 2>/dev/null)
+    local rc=$?
+    if [ "$out" = "$expected_out" ] && [ "$rc" = "$expected_rc" ]; then
+        log_pass "$name"
+    else
+        log_fail "$name (got '$out' rc=$rc, expected '$expected_out' rc=$expected_rc)"
+    fi
+}
+
+# Run a script and check its stderr holds a message
+expect_error() {
+    local name="$1"
+    local message="$2"
+    local script="$3"
+
+    local err
+    err=$(printf '%s\n' "$script" | timeout 5s "$MINISHELL" 2>&1 >/dev/null)
+    if [[ "$err" == *"$message"* ]]; then
+        log_pass "$name"
+    else
+        log_fail "$name (got '$err', expected '$message')"
+    fi
+}
+
+# Print the stats -p table after a pipeline
+stage_table() {
+    printf '%s\nstats -p\n' "$1" | timeout 5s "$MINISHELL" 2>/dev/null \
+        | sed -n '/^stage/,$p'
+}
+
+test_pipestatus() {
+    log_test "Testing PIPESTATUS..."
+    expect "Every stage" "0 1 0" 0 "$(printf 'true | false | true\necho $PIPESTATUS')"
+    expect "Single command" "1" 0 "$(printf 'false\necho $PIPESTATUS')"
+    expect "Command not found" "127 0" 0 \
+        "$(printf 'nosuch | cat\necho $PIPESTATUS')"
+    expect "Builtin stages" "$(printf 'y\n3 0\n0 0')" 0 \
+        "$(printf 'exit 3 | echo y\necho $PIPESTATUS\necho x | cat >/dev/null\necho $PIPESTATUS')"
+    expect "Builtin writer and in-shell builtin" "$(printf 'yo\n0 0')" 0 \
+        "$(printf 'echo hi | echo yo\necho $PIPESTATUS')"
+    expect "Signals" "141 0" 0 \
+        "$(printf 'yes | head -c 1 >/dev/null\necho $PIPESTATUS')"
+    expect "Replaced by the next command" "$(printf '0 1\n0')" 0 \
+        "$(printf 'true | false\necho $PIPESTATUS\necho $PIPESTATUS')"
+    expect "Before any pipeline" "[]" 0 'echo [$PIPESTATUS]'
+}
+
+test_pipefail() {
+    log_test "Testing pipefail..."
+    expect "Off by default" "0" 0 "$(printf 'false | true\necho $?')"
+    expect "Rightmost failure" "2" 0 \
+        "$(printf 'set -o pipefail\nexit 1 | exit 2 | true\necho $?')"
+    expect "Builtin writer and in-shell builtin" "$(printf 'yo\nok')" 0 \
+        "$(printf 'set -o pipefail\necho hi | echo yo && echo ok || echo FAILED')"
+    expect "All succeed" "0" 0 "$(printf 'set -o pipefail\ntrue | true\necho $?')"
+    expect "Turned off" "0" 0 \
+        "$(printf 'set -o pipefail\nset +o pipefail\nfalse | true\necho $?')"
+    expect "Exit status of the shell" "" 1 \
+        "$(printf 'set -o pipefail\nfalse | true')"
+}
+
+test_set() {
+    log_test "Testing the set builtin..."
+    expect "set -o" "$(printf 'pipefail       \toff')" 0 "set -o"
+    expect "set +o" "set -o pipefail" 0 "$(printf 'set -o pipefail\nset +o')"
+    expect "No arguments" "$(printf 'pipefail       \ton')" 0 \
+        "$(printf 'set -o pipefail\nset')"
+    expect "Invalid option" "2" 0 "$(printf 'set -e\necho $?')"
+    expect "Invalid option name" "2" 0 "$(printf 'set -o nosuch\necho $?')"
+    expect_error "Usage" "set [-o|+o] [pipefail]" "set -x"
+    expect_error "Bad name" "invalid option name" "set -o nosuch"
+    expect "type set" "set is a shell builtin" 0 "type set"
+}
+
+test_stats() {
+    log_test "Testing stats -p..."
+    local table
+
+    table=$(stage_table "true | false | echo x >/dev/null")
+    if [ "$(echo "$table" | head -n 1)" = "$(printf 'stage\tpid\tstatus\treal\tuser\tsys\tmaxrss')" ] \
+        && [ "$(echo "$table" | wc -l)" = 4 ]; then
+        log_pass "One row per stage"
+    else
+        log_fail "One row per stage (got '$table')"
+    fi
+    if echo "$table" | awk -F'\t' 'NR == 2 && $2 > 0 && $3 == 0 { ok = 1 }
+        NR == 3 && $3 == 1 { n++ } NR == 4 && $2 == 0 { n++ }
+        END { exit !(ok && n == 2) }'; then
+        log_pass "Pids and statuses, 0 for stages in the shell"
+    else
+        log_fail "Pids and statuses, 0 for stages in the shell (got '$table')"
+    fi
+    table=$(stage_table "sleep 0.2 | true")
+    if echo "$table" | awk -F'\t' 'NR == 2 { exit !($4 >= 0.2 && $7 > 0) }'; then
+        log_pass "Real time and memory"
+    else
+        log_fail "Real time and memory (got '$table')"
+    fi
+    table=$(stage_table "echo x >/dev/null")
+    if [ "$(echo "$table" | wc -l)" = 2 ]; then
+        log_pass "Single builtin"
+    else
+        log_fail "Single builtin (got '$table')"
+    fi
+    expect "Usage" "2" 0 "$(printf 'stats -x 2>/dev/null\necho $?')"
+}
+
+main() {
+    echo "=========================================="
+    echo "Pipeline Status Test Suite"
+    echo "=========================================="
+
+    if [ ! -f "$MINISHELL" ]; then
+        echo -e "${RED}Error: minishell binary not found. Run 'make' first.${NC}"
+        exit 1
+    fi
+
+    test_pipestatus
+    test_pipefail
+    test_set
+    test_stats
+
+    echo "=========================================="
+    echo "Test Results:"
+    echo "Passed: $TESTS_PASSED"
+    echo "Failed: $TESTS_FAILED"
+    echo "Total:  $((TESTS_PASSED + TESTS_FAILED))"
+
+    if [ $TESTS_FAILED -eq 0 ]; then
+        echo -e "${GREEN}All tests passed! ✅${NC}"
+        exit 0
+    else
+        echo -e "${RED}Some tests failed! ❌${NC}"
+        exit 1
+    fi
+}
+
+main "$@"
@@ -0,0 +1,125 @@
+#!/bin/bash
+
+# Plan Cache Test Script
+# Tests: repeated lines hit the parsed-plan cache, cached plans still expand
+# at execution time, PLAN_CACHE_SIZE, words that bypass the expander and
+# the stats builtin
+
+MINISHELL="./minishell"
+
+# Colors for output
+RED='\033[0;31m'
+GREEN='\033[0;32m'
+YELLOW='\033[1;33m'
+NC='\033[0m' # No Color
+
+# Test counter
+TESTS_PASSED=0
+TESTS_FAILED=0
+
+# Helper functions
+log_test() {
+    echo -e "${YELLOW}[TEST]${NC} $1"
+}
+
+log_pass() {
+    echo -e "${GREEN}[PASS]${NC} $1"
+    ((TESTS_PASSED++))
+}
+
+log_fail() {
+    echo -e "${RED}[FAIL]${NC} $1"
+    ((TESTS_FAILED++))
+}
+
+# Feed a script to minishell and compare stdout and exit status
+expect() {
+    local name="$1"
+    local expected_out="$2"
+    local expected_rc="$3"
+    local script="$4"
+
+    local out
+    out=$(printf '%s\n' "$script" | timeout 5s "$MINISHELL" 2>/dev/null)
+    local rc=$?
+    if [ "$out" = "$expected_out" ] && [ "$rc" = "$expected_rc" ]; then
+        log_pass "$name"
+    else
+        log_fail "$name (got '$out' rc=$rc, expected '$expected_out' rc=$expected_rc)"
+    fi
+}
+
+# Expected stats output: plan cache counters, words expanded, words
+# bypassed, processes forked and spawned
+stats_out() {
+    printf 'plan cache: %s\nwords: expanded %s, bypassed %s\nprocesses: forked %s, spawned %s' \
+        "$1" "$2" "$3" "${4:-0}" "${5:-0}"
+}
+
+test_hits() {
+    log_test "Testing cache hits..."
+    expect "Repeated line hits" "$(stats_out "hits 2, misses 2, evictions 0, entries 2/64" 0 4 0 3)" 0 \
+        "$(printf 'true\ntrue\ntrue\nstats')"
+    expect "Syntax errors are not cached" "$(stats_out "hits 0, misses 3, evictions 0, entries 1/64" 0 1)" 0 \
+        "$(printf 'echo |\necho |\nstats')"
+    expect "stats -r resets the counters" "$(stats_out "hits 0, misses 0, evictions 0, entries 2/64" 0 0)" 0 \
+        "$(printf 'true\ntrue\nstats -r')"
+}
+
+test_cached_plans_expand() {
+    log_test "Testing expansion of cached plans..."
+    expect "\$? is read on every run" "$(printf '1\n0')" 0 \
+        "$(printf 'false\necho $?\ntrue\necho $?')"
+    expect "Variables are read on every run" "$(printf 'a\nb')" 0 \
+        "$(printf 'export V=a\necho $V\nexport V=b\necho $V')"
+    expect "Heredocs are read on every run" "$(printf 'one\ntwo')" 0 \
+        "$(printf 'cat << E\none\nE\ncat << E\ntwo\nE')"
+}
+
+test_size() {
+    log_test "Testing PLAN_CACHE_SIZE..."
+    expect "Least recently used plan is evicted" \
+        "$(stats_out "hits 1, misses 5, evictions 2, entries 2/2" 0 7 1 3)" 0 \
+        "$(printf 'export PLAN_CACHE_SIZE=2\ntrue\nfalse\ntrue\n: \nstats')"
+    expect "Size 0 disables the cache" "$(stats_out "hits 0, misses 1, evictions 0, entries 0/0" 0 5 0 2)" 0 \
+        "$(printf 'export PLAN_CACHE_SIZE=0\ntrue\ntrue\nstats')"
+    local out
+    out=$(printf 'stats\n' | PLAN_CACHE_SIZE=5 timeout 5s "$MINISHELL" 2>/dev/null)
+    if [ "$out" = "$(stats_out "hits 0, misses 1, evictions 0, entries 1/5" 0 1)" ]; then
+        log_pass "Size is read from the environment at startup"
+    else
+        log_fail "Size is read from the environment at startup (got '$out')"
+    fi
+}
+
+test_bypass() {
+    log_test "Testing expansion bypass..."
+    expect "Plain words bypass the expander" \
+        "$(printf 'a v x b\\c plain\n'; stats_out "hits 0, misses 3, evictions 0, entries 3/64" 3 7)" 0 \
+        "$(printf 'export V=v\necho a $V "x" b\\c plain > /dev/stdout\nstats')"
+    expect "Bypassed words are still quote-free" "$(printf 'a\na b')" 0 \
+        "$(printf 'echo a\necho a"" b')"
+}
+
+main() {
+    test_hits
+    test_cached_plans_expand
+    test_size
+    test_bypass
+
+    echo "=========================================="
+    echo "Test Results:"
+    echo "Passed: $TESTS_PASSED"
+    echo "Failed: $TESTS_FAILED"
+    echo "Total:  $((TESTS_PASSED + TESTS_FAILED))"
+
+    if [ $TESTS_FAILED -eq 0 ]; then
+        echo -e "${GREEN}All tests passed! ✅${NC}"
+        exit 0
+    else
+        echo -e "${RED}Some tests failed! ❌${NC}"
+        exit 1
+    fi
+}
+
+main "$@"
@@ -0,0 +1,154 @@
+#!/bin/bash
+
+# Redirection Test Script
+# Tests: numbered fds (N>file, N>>file, N<file), duplication (N>&M, N<&M,
+# N>&-), &>file, repeated targets, programs that cannot be started and
+# parent builtins restoring their fds
+
+MINISHELL="$(pwd)/minishell"
+WORKDIR=$(mktemp -d)
+
+# Colors for output
+RED='\033[0;31m'
+GREEN='\033[0;32m'
+YELLOW='\033[1;33m'
+NC='\033[0m' # No Color
+
+# Test counter
+TESTS_PASSED=0
+TESTS_FAILED=0
+
+# Helper functions
+log_test() {
+    echo -e "${YELLOW}[TEST]${NC} $1"
+}
+
+log_pass() {
+    echo -e "${GREEN}[PASS]${NC} $1"
+    ((TESTS_PASSED++))
+}
+
+log_fail() {
+    echo -e "${RED}[FAIL]${NC} $1"
+    ((TESTS_FAILED++))
+}
+
+# Feed a script to minishell in an empty directory and compare stdout and
+# exit status; stderr is discarded unless the script redirects it
+expect() {
+    local name="$1"
+    local expected_out="$2"
+    local expected_rc="$3"
+    local script="$4"
+
+    local out
+    out=$(cd "$WORKDIR" && printf '%s\n' "$script" \
+        | timeout 5s "$MINISHELL" 2>/dev/null)
+    local rc=$?
+    if [ "$out" = "$expected_out" ] && [ "$rc" = "$expected_rc" ]; then
+        log_pass "$name"
+    else
+        log_fail "$name (got '$out' rc=$rc, expected '$expected_out' rc=$expected_rc)"
+    fi
+    find "$WORKDIR" -mindepth 1 -delete
+}
+
+NOSUCH="ls: cannot access 'nosuch': No such file or directory"
+
+test_numbered() {
+    log_test "Testing numbered fds..."
+    expect "2>file" "$NOSUCH" 0 "$(printf 'ls nosuch 2>err\ncat err')"
+    expect "2>>file appends" "$(printf '%s\n%s' "$NOSUCH" "$NOSUCH")" 0 \
+        "$(printf 'ls nosuch 2>>err\nls nosuch 2>>err\ncat err')"
+    expect "0<file" "in" 0 "$(printf 'echo in >f\ncat 0<f')"
+    expect "3<file read through <&3" "in" 0 \
+        "$(printf 'echo in >f\ncat 3<f <&3')"
+    expect "A number inside a word is an argument" "a2" 0 \
+        "$(printf 'echo a2>f\ncat f')"
+    expect "fds above 9 are refused" "1" 0 "$(printf 'echo x 12>f\necho $?')"
+    expect "A number too large for an fd is a word" "hi 99999999999" 0 \
+        "$(printf 'echo hi 99999999999>f\ncat f')"
+}
+
+test_duplication() {
+    log_test "Testing fd duplication..."
+    expect "2>&1 into a pipe" "LS: CANNOT ACCESS 'NOSUCH': NO SUCH FILE OR DIRECTORY" 0 \
+        "ls nosuch 2>&1 | tr a-z A-Z"
+    expect ">file 2>&1" "2" 0 \
+        "$(printf 'ls -d / nosuch >f 2>&1\ngrep -c . f')"
+    expect "2>&1 >file keeps stderr on stdout" "$(printf '%s\n/' "$NOSUCH")" 0 \
+        "$(printf 'ls -d / nosuch 2>&1 >f\ncat f')"
+    expect "Swap stdout and stderr" "$NOSUCH" 0 \
+        "$(printf 'ls -d / nosuch 3>&1 1>&2 2>&3\ntrue')"
+    expect ">&2 on a builtin" "" 0 "echo hidden >&2"
+    expect "Closed stdout" "1" 0 "$(printf 'echo x >&-\necho $?')"
+    expect "Closed fd is a bad source" "1" 0 \
+        "$(printf 'echo x 3>&- >&3\necho $?')"
+    expect "Unopened fd" "minishell: 9: Bad file descriptor" 0 \
+        "$(printf 'ls 2>&1 >&9\ntrue')"
+    expect "Non-numeric <&word" "1" 0 "$(printf 'cat <&zz\necho $?')"
+}
+
+test_all() {
+    log_test "Testing &>file..."
+    expect "&>file" "2" 0 "$(printf 'ls -d / nosuch &>f\ngrep -c . f')"
+    expect ">&word is &>word" "2" 0 \
+        "$(printf 'ls -d / nosuch >&f\ngrep -c . f')"
+    expect "&> ends a word" "x" 0 "$(printf 'echo x&>f\ncat f')"
+}
+
+test_targets() {
+    log_test "Testing repeated targets..."
+    expect "> a > b > c creates all, writes the last" "$(printf 'a\nb\nc\nhi')" 0 \
+        "$(printf 'echo hi > a > b > c\nls\ncat a b c')"
+    expect "Pipeline stage keeps its pipe for 2>&1" "x" 0 \
+        "echo x 2>&1 | cat"
+    expect "Heredoc on fd 3" "body" 0 \
+        "$(printf 'cat 3<<EOF <&3\nbody\nEOF')"
+}
+
+test_spawn_failures() {
+    log_test "Testing programs that cannot be started..."
+    expect "A failed open stops the later ones" "1" 0 \
+        "$(printf 'cat <nosuch >made\necho $?\nls')"
+    (cd "$WORKDIR" && printf 'garbage\n' > bad && chmod +x bad && mkfifo p \
+        && (timeout 5s cat p >/dev/null &))
+    expect "A program that cannot run opens its FIFO once" "126" 0 \
+        "$(printf './bad >p 2>/dev/null\necho $?')"
+}
+
+test_parent_builtins() {
+    log_test "Testing parent builtins..."
+    expect "cd error to a file, stderr restored" "1" 0 \
+        "$(printf 'cd /nonexistent 2>err\nls nosuch 2>&1 >/dev/null | wc -l')"
+    expect "export listing to a file, stdout restored" "yes" 0 \
+        "$(printf 'export >f\necho yes')"
+    expect "exit status of a failed redirection" "1" 0 \
+        "$(printf 'export A=1 >&9\necho $?')"
+}
+
+main() {
+    test_numbered
+    test_duplication
+    test_all
+    test_targets
+    test_spawn_failures
+    test_parent_builtins
+    rmdir "$WORKDIR"
+
+    echo "=========================================="
+    echo "Test Results:"
+    echo "Passed: $TESTS_PASSED"
+    echo "Failed: $TESTS_FAILED"
+    echo "Total:  $((TESTS_PASSED + TESTS_FAILED))"
+
+    if [ $TESTS_FAILED -eq 0 ]; then
+        echo -e "${GREEN}All tests passed! ✅${NC}"
+        exit 0
+    else
+        echo -e "${RED}Some tests failed! ❌${NC}"
+        exit 1
+    fi
+}
+
+main "$@"
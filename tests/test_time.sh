@@ -0,0 +1,170 @@
+#!/bin/bash
+
+# Time Keyword Test Script
+# Tests: the time reserved word in front of a pipeline reports its real,
+# user and sys time on stderr in bash's default format, POSIX's for
+# time -p, or TIMEFORMAT's with its %R %U %S %P %J sequences, and leaves
+# the pipeline's output and status as they are
+
+MINISHELL="$(pwd)/minishell"
+
+# Colors for output
+RED='\033[0;31m'
+GREEN='\033[0;32m'
+YELLOW='\033[1;33m'
+NC='\033[0m' # No Color
+
+# Test counter
+TESTS_PASSED=0
+TESTS_FAILED=0
+
+# Helper functions
+log_test() {
+    echo -e "${YELLOW}[TEST]${NC} $1"
+}
+
+log_pass() {
+    echo -e "${GREEN}[PASS]${NC} $1"
+    ((TESTS_PASSED++))
+}
+
+log_fail() {
+    echo -e "${RED}[FAIL]${NC} $1"
+    ((TESTS_FAILED++))
+}
+
+# Feed a script to minishell and compare stdout and exit status
+expect() {
+    local name="$1"
+    local expected_out="$2"
+    local expected_rc="$3"
+    local script="$4"
+
+    local out
+    out=$(printf '%s\n' "$script" | timeout 5s "$MINISHELL" 2>/dev/null)
+    local rc=$?
+    if [ "$out" = "$expected_out" ] && [ "$rc" = "$expected_rc" ]; then
+        log_pass "$name"
+    else
+        log_fail "$name (got '$out' rc=$rc, expected '$expected_out' rc=$expected_rc)"
+    fi
+}
+
+# Run a script and check its stderr against an extended regex
+expect_report() {
+    local name="$1"
+    local pattern="$2"
+    local script="$3"
+
+    local err
+    err=$(printf '%s\n' "$script" | timeout 5s "$MINISHELL" 2>&1 >/dev/null)
+    if [[ "$err" =~ ^${pattern}$ ]]; then
+        log_pass "$name"
+    else
+        log_fail "$name (got '$err', expected /$pattern/)"
+    fi
+}
+
+# Check that a JSON report parses and satisfies a Python expression on r
+expect_json() {
+    local name="$1"
+    local check="$2"
+    local script="$3"
+
+    local err
+    err=$(printf 'export TIMEFORMAT=%%J\n%s\n' "$script" \
+        | timeout 5s "$MINISHELL" 2>&1 >/dev/null)
+    if python3 -c "import json, sys; r = json.loads(sys.argv[1]); sys.exit(not ($check))" \
+        "$err" 2>/dev/null; then
+        log_pass "$name"
+    else
+        log_fail "$name (got '$err')"
+    fi
+}
+
+test_formats() {
+    log_test "Testing report formats..."
+    expect_report "Default format" \
+        $'\nreal\t0m0\\.2[0-9]{2}s\nuser\t0m0\\.[0-9]{3}s\nsys\t0m0\\.[0-9]{3}s' \
+        "time sleep 0.2"
+    expect_report "time -p" \
+        $'real 0\\.[0-9]{2}\nuser 0\\.[0-9]{2}\nsys 0\\.[0-9]{2}' "time -p true"
+    expect_report "TIMEFORMAT" "r=0\\.2[0-9]{5} u=0 p=[0-9]+\\.[0-9]{2} %" \
+        "$(printf 'export TIMEFORMAT="r=%%6R u=%%0U p=%%P %%%%"\ntime sleep 0.2')"
+    expect_report "Long form" "0m0\\.[0-9]s" \
+        "$(printf 'export TIMEFORMAT=%%1lR\ntime true')"
+    expect_report "Unknown sequences are kept" "%x %9 %" \
+        "$(printf 'export TIMEFORMAT="%%x %%9 %%"\ntime true')"
+    expect_report "Empty TIMEFORMAT" "" \
+        "$(printf 'export TIMEFORMAT=\ntime true')"
+    expect_report "time -p ignores TIMEFORMAT" "real 0\\.[0-9]{2}.*" \
+        "$(printf 'export TIMEFORMAT=x\ntime -p true')"
+}
+
+test_json() {
+    log_test "Testing the JSON report..."
+    expect_json "One stage per command" \
+        "len(r['stages']) == 3 and r['stages'][0]['status'] == 141 and all(s['pid'] > 0 for s in r['stages'])" \
+        "time yes | head -c 100000 | wc -c"
+    expect_json "Real time covers the pipeline" \
+        "r['real'] >= 0.2 and r['stages'][0]['real'] >= 0.2 and r['stages'][0]['maxrss'] > 0" \
+        "time sleep 0.2 | true"
+    expect_json "CPU time of the stages" \
+        "r['user'] + r['sys'] >= 0.05 and abs(r['user'] - sum(s['user'] for s in r['stages'])) < 1e-5" \
+        "time yes | head -c 100000000 | wc -c"
+    expect_json "Builtin stages have pid 0" \
+        "[s['pid'] for s in r['stages']][0] == 0" "time echo x | cat"
+    expect_json "time alone" "r['stages'] == []" "time"
+}
+
+test_semantics() {
+    log_test "Testing what time leaves alone..."
+    expect "Output and status" "$(printf 'a\n1')" 0 \
+        "$(printf 'time echo a | cat\ntime false\necho $?')"
+    expect "Redirections of the pipeline" "" 0 "$(printf 'export TIMEFORMAT=x\ntime echo a >/dev/null 2>&1')"
+    expect_report "Report ignores the pipeline's stderr" "x" \
+        "$(printf 'export TIMEFORMAT=x\ntime nosuch 2>/dev/null')"
+    expect "In a list" "$(printf 'after\nyes')" 0 \
+        "$(printf 'time; echo after\ntime true && echo yes')"
+    expect "Quoted time is a command" "127" 0 "$(printf '\"time\" true\necho $?')"
+    expect "time as an argument" "time -p" 0 "echo time -p"
+    expect "type time" "time is a shell keyword" 0 "type time"
+    local err
+    err=$(TIMEFORMAT=x timeout 5s "$MINISHELL" -c "time true" 2>&1)
+    if [ "$err" = "x" ]; then
+        log_pass "Last command of -c"
+    else
+        log_fail "Last command of -c (got '$err')"
+    fi
+}
+
+main() {
+    echo "=========================================="
+    echo "Time Keyword Test Suite"
+    echo "=========================================="
+
+    if [ ! -f "$MINISHELL" ]; then
+        echo -e "${RED}Error: minishell binary not found. Run 'make' first.${NC}"
+        exit 1
+    fi
+
+    test_formats
+    test_json
+    test_semantics
+
+    echo "=========================================="
+    echo "Test Results:"
+    echo "Passed: $TESTS_PASSED"
+    echo "Failed: $TESTS_FAILED"
+    echo "Total:  $((TESTS_PASSED + TESTS_FAILED))"
+
+    if [ $TESTS_FAILED -eq 0 ]; then
+        echo -e "${GREEN}All tests passed! ✅${NC}"
+        exit 0
+    else
+        echo -e "${RED}Some tests failed! ❌${NC}"
+        exit 1
+    fi
+}
+
+main "$@"
@@ -0,0 +1,163 @@
+#!/bin/bash
+
+# Trace Test Script
+# Tests: MINISHELL_TRACE=file writes a Chrome trace of the shell's phases
+# (parse, expansion, heredocs, fork, posix_spawn, wait4) and of each child
+# on its own pid track (start, execve, exit status), as valid JSON, and
+# nothing at all when it is unset
+
+MINISHELL="$(pwd)/minishell"
+TRACE="$(mktemp -u /tmp/minishell_trace.XXXXXX)"
+
+# Colors for output
+RED='\033[0;31m'
+GREEN='\033[0;32m'
+YELLOW='\033[1;33m'
+NC='\033[0m' # No Color
+
+# Test counter
+TESTS_PASSED=0
+TESTS_FAILED=0
+
+# Helper functions
+log_test() {
+    echo -e "${YELLOW}[TEST]${NC} $1"
+}
+
+log_pass() {
+    echo -e "${GREEN}[PASS]${NC} $1"
+    ((TESTS_PASSED++))
+}
+
+log_fail() {
+    echo -e "${RED}[FAIL]${NC} $1"
+    ((TESTS_FAILED++))
+}
+
+# Trace a script and check a Python expression over the events e (a list
+# of dicts), the shell's pid s and the child tracks c (pid -> events)
+expect_trace() {
+    local name="$1"
+    local check="$2"
+    local script="$3"
+
+    rm -f "$TRACE"
+    printf '%s\n' "$script" | MINISHELL_TRACE="$TRACE" timeout 5s "$MINISHELL" \
+        >/dev/null 2>&1
+    if python3 - "$TRACE" "$check" <<'PY' 2>/dev/null
+import json, sys
+e = json.load(open(sys.argv[1]))
+s = e[0]['pid']
+c = {}
+for x in e:
+    if x['pid'] != s:
+        c.setdefault(x['pid'], []).append(x)
+def names(pid):
+    return [x['name'] + x['ph'] for x in e if x['pid'] == pid]
+sys.exit(not eval(sys.argv[2]))
+PY
+    then
+        log_pass "$name"
+    else
+        log_fail "$name ($(head -c 300 "$TRACE" 2>/dev/null))"
+    fi
+}
+
+test_shell_phases() {
+    log_test "Testing the shell's phases..."
+    expect_trace "Valid JSON, closed at exit" \
+        "e[0]['name'] == 'process_name' and e[-1]['name'] == 'exit'" "true"
+    expect_trace "Parse, expansion, spawn and wait" \
+        "names(s)[1:9] == ['parser_parseB', 'parser_parseE', 'expansionB', 'expansionE', 'posix_spawnB', 'posix_spawnE', 'wait4B', 'wait4E']" \
+        "true"
+    expect_trace "Cached plans are not parsed again" \
+        "names(s).count('parser_parseB') == 1 and 'plan_cache_hiti' in names(s)" \
+        "$(printf 'true\ntrue')"
+    expect_trace "Heredocs" "'process_heredocsB' in names(s)" \
+        "$(printf 'cat <<EOF\nx\nEOF')"
+    expect_trace "Fork" "'forkB' in names(s) and 'forkE' in names(s)" \
+        "nosuch"
+    expect_trace "Timestamps do not go back on a track" \
+        "all(a['ts'] <= b['ts'] for a, b in zip(e[:-1], e[1:]) if a['pid'] == b['pid'] == s)" \
+        "$(printf 'echo a | cat | wc -l\ncat <<EOF\nx\nEOF')"
+}
+
+test_child_tracks() {
+    log_test "Testing child tracks..."
+    expect_trace "One track per child" \
+        "sorted(x[0]['args']['name'] for x in c.values()) == ['cat', 'wc']" \
+        "echo a | cat | wc -l"
+    expect_trace "Spawned child: start, execve, exit status" \
+        "[x['ph'] for x in list(c.values())[0]] == ['M', 'B', 'i', 'E'] and list(c.values())[0][3]['args']['status'] == 1" \
+        "false"
+    expect_trace "Forked child writes its own execve" \
+        "[x['ph'] for x in list(c.values())[0]] == ['M', 'B', 'i', 'E'] and list(c.values())[0][2]['args']['path'].endswith('/true')" \
+        "true 5>/dev/null"
+    expect_trace "Forked builtin" \
+        "list(c.values())[0][1]['name'] == 'cd' and 'forkB' in names(s)" \
+        "cd / | true"
+    expect_trace "Command not found" \
+        "list(c.values())[0][-1]['args']['status'] == 127" "nosuch"
+    expect_trace "Names that are not UTF-8 stay valid JSON" \
+        "list(c.values())[0][1]['name'] == 'nosuch\\xff'" "$(printf 'nosuch\xff')"
+}
+
+test_modes() {
+    log_test "Testing when tracing is on..."
+    rm -f "$TRACE"
+    MINISHELL_TRACE="$TRACE" timeout 5s "$MINISHELL" -c 'true; /bin/echo x' \
+        >/dev/null 2>&1
+    if python3 -c "import json, sys; e = json.load(open(sys.argv[1])); sys.exit(not (e[-2]['name'] == 'execve' and e[-1]['name'] == 'exit'))" \
+        "$TRACE" 2>/dev/null; then
+        log_pass "The last command of -c ends the trace"
+    else
+        log_fail "The last command of -c ends the trace ($(cat "$TRACE"))"
+    fi
+    rm -f "$TRACE"
+    echo true | timeout 5s "$MINISHELL" >/dev/null 2>&1
+    if [ ! -e "$TRACE" ]; then
+        log_pass "Off without MINISHELL_TRACE"
+    else
+        log_fail "Off without MINISHELL_TRACE"
+    fi
+    local out
+    out=$(echo 'echo ok' | MINISHELL_TRACE=/nonexistent/trace timeout 5s \
+        "$MINISHELL" 2>&1)
+    if [ "$out" = "$(printf 'minishell: MINISHELL_TRACE: /nonexistent/trace: No such file or directory\nok')" ]; then
+        log_pass "A file that cannot be opened"
+    else
+        log_fail "A file that cannot be opened (got '$out')"
+    fi
+}
+
+main() {
+    echo "=========================================="
+    echo "Trace Test Suite"
+    echo "=========================================="
+
+    if [ ! -f "$MINISHELL" ]; then
+        echo -e "${RED}Error: minishell binary not found. Run 'make' first.${NC}"
+        exit 1
+    fi
+
+    test_shell_phases
+    test_child_tracks
+    test_modes
+    rm -f "$TRACE"
+
+    echo "=========================================="
+    echo "Test Results:"
+    echo "Passed: $TESTS_PASSED"
+    echo "Failed: $TESTS_FAILED"
+    echo "Total:  $((TESTS_PASSED + TESTS_FAILED))"
+
+    if [ $TESTS_FAILED -eq 0 ]; then
+        echo -e "${GREEN}All tests passed! ✅${NC}"
+        exit 0
+    else
+        echo -e "${RED}Some tests failed! ❌${NC}"
+        exit 1
+    fi
+}
+
+main "$@"
@@ -0,0 +1,107 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   test_arena.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/21 17:45:12 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/09/21 17:45:12 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "unit.h"
+
+/*
+** Tests for the per-line parse tree arena: aligned bump allocation, a
+** reset that keeps a few blocks and frees the rest, and a parse tree built
+** without any
+** per-node malloc once the arena is warm.
+*/
+
+static void	test_bump(void)
+{
+	t_arena	arena;
+	char	*a;
+	char	*b;
+	char	*big;
+
+	ft_bzero(&arena, sizeof(arena));
+	a = arena_alloc(&arena, 3);
+	b = arena_alloc(&arena, 5);
+	unit_check(a && b && ((size_t)a % ARENA_ALIGN) == 0
+		&& ((size_t)b % ARENA_ALIGN) == 0, "allocations are aligned");
+	unit_check(b == a + ARENA_ALIGN, "allocations are bumped");
+	big = arena_alloc(&arena, ARENA_BLOCK_SIZE * 2);
+	unit_check(big != NULL, "oversized allocations get their own block");
+	big[ARENA_BLOCK_SIZE * 2 - 1] = 'x';
+	arena_reset(&arena);
+	unit_check(arena_alloc(&arena, 3) == a, "reset rewinds to the start");
+	unit_check(!ft_strncmp(arena_strdup(&arena, "span"), "span", 5),
+		"arena_strdup copies");
+	unit_check(arena.head->next != NULL, "reset keeps a few blocks");
+	arena_alloc(&arena, ARENA_BLOCK_SIZE * ARENA_KEEP_BLOCKS);
+	arena_reset(&arena);
+	unit_check(arena.head->next == NULL,
+		"reset frees the blocks of a long line");
+	arena_destroy(&arena);
+	unit_check(arena.head == NULL, "destroy releases every block");
+}
+
+static t_cmd	*parse_once(t_shell *sh, const char *line)
+{
+	t_lexer		*lexer;
+	t_parser	*parser;
+	t_pipeline	*list;
+
+	if (init_lexer_parser((char *)line, &lexer, &parser, sh))
+		return (NULL);
+	list = parser_parse(parser);
+	parser_destroy(parser);
+	lexer_destroy(lexer);
+	if (!list)
+		return (NULL);
+	return (list->cmds);
+}
+
+static int	in_first_block(t_arena *arena, void *ptr)
+{
+	char	*start;
+
+	start = (char *)arena->head;
+	return ((char *)ptr > start && (char *)ptr < start + ARENA_HEADER + arena->head->cap);
+}
+
+static void	test_parse_tree(void)
+{
+	t_shell	sh;
+	t_cmd	*cmd;
+	size_t	mallocs;
+	size_t	frees;
+
+	ft_bzero(&sh, sizeof(sh));
+	parse_once(&sh, "warm up");
+	arena_reset(&sh.arena);
+	mallocs = unit_malloc_count();
+	frees = unit_free_count();
+	cmd = parse_once(&sh, "cat <in a b c | grep -v x >out | wc -l >>log");
+	unit_check(cmd && cmd->next && cmd->next->next, "pipeline parsed");
+	unit_check(unit_malloc_count() - mallocs == unit_free_count() - frees,
+		"only parse temporaries are malloc'd");
+	unit_check(ARENA_DEBUG || (in_first_block(&sh.arena, cmd)
+			&& in_first_block(&sh.arena, cmd->words)
+			&& in_first_block(&sh.arena, cmd->words[3])
+			&& in_first_block(&sh.arena, cmd->redirs->word)),
+		"nodes, words and strings live in the arena");
+	arena_reset(&sh.arena);
+	arena_destroy(&sh.arena);
+}
+
+int	main(void)
+{
+	if (!ARENA_DEBUG)
+		test_bump();
+	test_parse_tree();
+	return (unit_report("arena"));
+}
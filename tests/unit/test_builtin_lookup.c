@@ -0,0 +1,66 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   test_builtin_lookup.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/10/02 09:14:36 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/10/02 09:14:36 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "unit.h"
+
+/*
+** Tests for the builtin table: every builtin name resolves to its own
+** descriptor, near misses resolve to nothing and only the builtins that
+** change the shell run in the parent.
+*/
+
+static void	test_names(t_shell *shell)
+{
+	t_builtin_id	id;
+	int				found;
+
+	found = 0;
+	id = BUILTIN_NONE + 1;
+	while (id < BUILTIN_LOADABLE)
+	{
+		found += builtin_lookup(builtin_get(id)->name) == id;
+		id++;
+	}
+	unit_check(found == BUILTIN_LOADABLE - 1, "every builtin name resolves");
+	unit_check(!builtin_lookup("ech") && !builtin_lookup("echoo")
+		&& !builtin_lookup("ECHO") && !builtin_lookup("/bin/echo"),
+		"near misses do not resolve");
+	unit_check(!builtin_lookup("") && !builtin_lookup("e")
+		&& !builtin_lookup(NULL), "empty and short names do not resolve");
+	unit_check(!is_builtin("ls", shell) && is_builtin("type", shell),
+		"is_builtin follows the table");
+}
+
+static void	test_parent(void)
+{
+	unit_check(builtin_get(BUILTIN_CD)->flags == BUILTIN_IN_PARENT
+		&& builtin_get(BUILTIN_EXIT)->flags == BUILTIN_IN_PARENT
+		&& builtin_get(BUILTIN_HASH)->flags == BUILTIN_IN_PARENT
+		&& builtin_get(BUILTIN_ENABLE)->flags == BUILTIN_IN_PARENT,
+		"shell-changing builtins only run in the parent alone");
+	unit_check(builtin_get(BUILTIN_ECHO)->flags == BUILTIN_IN_PIPELINE
+		&& builtin_get(BUILTIN_TYPE)->flags == BUILTIN_IN_PIPELINE,
+		"read-only builtins run in the parent as pipeline stages");
+	unit_check(builtin_get(BUILTIN_LOADABLE)->flags
+		== (BUILTIN_IN_PARENT | BUILTIN_IN_PIPELINE),
+		"loaded builtins run in the parent, alone or as a stage");
+}
+
+int	main(void)
+{
+	t_shell	shell;
+
+	ft_bzero(&shell, sizeof(shell));
+	test_names(&shell);
+	test_parent();
+	return (unit_report("builtin_lookup"));
+}
@@ -0,0 +1,88 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   test_cmd_hash.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/28 12:05:33 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/09/28 12:05:33 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "unit.h"
+
+/*
+** Tests for the command hash: names map to paths through table growth,
+** re-hashing a name replaces its path, PATH is searched with a single
+** allocation and clearing releases every entry.
+*/
+
+static void	test_table(t_cmd_hash *table)
+{
+	char	name[16];
+	int		i;
+	int		found;
+
+	i = 0;
+	while (i < 100)
+	{
+		snprintf(name, sizeof(name), "cmd%d", i);
+		cmd_hash_add(table, name, ft_strjoin("/bin/", name));
+		i++;
+	}
+	found = 0;
+	while (i-- > 0)
+	{
+		snprintf(name, sizeof(name), "cmd%d", i);
+		found += cmd_hash_find(table, name)
+			&& !strcmp(cmd_hash_find(table, name)->path + 5, name);
+	}
+	unit_check(found == 100 && table->count == 100
+		&& table->n_buckets >= 100, "entries survive growth");
+	unit_check(!cmd_hash_find(table, "cmd100") && !cmd_hash_find(table, "cm"),
+		"unknown names miss");
+	cmd_hash_find(table, "cmd7")->hits = 3;
+	cmd_hash_add(table, "cmd7", ft_strdup("/usr/bin/cmd7"));
+	unit_check(table->count == 100 && cmd_hash_find(table, "cmd7")->hits == 0
+		&& !strcmp(cmd_hash_find(table, "cmd7")->path, "/usr/bin/cmd7"),
+		"hashing a name again replaces its path");
+}
+
+static void	test_search(t_shell *sh)
+{
+	size_t	mallocs;
+	char	*path;
+
+	mallocs = unit_malloc_count();
+	path = search_path_dirs("sh", "::/nonexistent:/bin:/usr/bin");
+	unit_check(path && !strcmp(path, "/bin/sh")
+		&& unit_malloc_count() == mallocs + 1,
+		"PATH search allocates only the match");
+	free(path);
+	unit_check(!search_path_dirs("no-such-command", "/bin:/usr/bin"),
+		"missing command is not found");
+	unit_check(!find_command_path("", sh), "empty name is not found");
+}
+
+int	main(void)
+{
+	t_shell	sh;
+	char	*envp[2];
+	size_t	frees;
+
+	ft_bzero(&sh, sizeof(sh));
+	envp[0] = "PATH=/bin:/usr/bin";
+	envp[1] = NULL;
+	if (env_init(&sh.env, envp))
+		return (1);
+	test_table(&sh.commands);
+	frees = unit_free_count();
+	cmd_hash_clear(&sh.commands);
+	unit_check(unit_free_count() == frees + 301 && !sh.commands.count
+		&& !cmd_hash_find(&sh.commands, "cmd1"), "clear frees every entry");
+	test_search(&sh);
+	env_destroy(&sh.env);
+	return (unit_report("cmd_hash"));
+}
@@ -0,0 +1,97 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   test_env.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/26 12:10:37 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/09/26 12:10:37 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "unit.h"
+
+/*
+** Tests for the hash-indexed environment: lookups, in-place updates,
+** insertion order, unset churn and the lazily rebuilt execve array.
+*/
+
+static void	test_basic(t_env *env)
+{
+	char	*envp[4];
+
+	envp[0] = "A=1";
+	envp[1] = "NOEQUALS";
+	envp[2] = "B=two=2";
+	envp[3] = NULL;
+	unit_check(env_init(env, envp) == 0 && env->count == 2,
+		"entries without '=' are skipped");
+	unit_check(!strcmp(env_get(env, "B"), "two=2")
+		&& env_get(env, "C") == NULL && env_find(env, "AB", 1) != NULL,
+		"lookups by name and by (pointer, length)");
+	env_set(env, "A", "3");
+	env_set(env, "C", NULL);
+	unit_check(!strcmp(env_get(env, "A"), "3")
+		&& !strcmp(env_get(env, "C"), "") && env->count == 3,
+		"set updates in place and adds new names");
+	unit_check(!ft_strcmp(env_envp(env)[0], "A=3")
+		&& !ft_strcmp(env_envp(env)[2], "C=") && !env_envp(env)[3],
+		"envp keeps insertion order");
+}
+
+static void	test_envp_cache(t_env *env)
+{
+	char	**first;
+
+	first = env_envp(env);
+	unit_check(env_envp(env) == first && !env->dirty,
+		"envp is reused while nothing changes");
+	env_unset(env, "A");
+	unit_check(env->dirty && env_get(env, "A") == NULL,
+		"unset marks envp dirty");
+	unit_check(!ft_strcmp(env_envp(env)[0], "B=two=2")
+		&& !env_envp(env)[2], "rebuilt envp drops unset names");
+}
+
+static void	test_churn(t_env *env)
+{
+	char	name[16];
+	size_t	i;
+	int		ok;
+
+	i = 0;
+	while (i < 20000)
+	{
+		snprintf(name, sizeof(name), "V%zu", i);
+		env_set(env, name, name);
+		if (i >= 10)
+		{
+			snprintf(name, sizeof(name), "V%zu", i - 10);
+			env_unset(env, name);
+		}
+		i++;
+	}
+	ok = env->count == 12 && env->index_cap <= 64;
+	unit_check(ok, "unset slots are reclaimed under churn");
+	unit_check(!strcmp(env_get(env, "V19995"), "V19995")
+		&& env_get(env, "V19989") == NULL, "lookups survive rebuilds");
+}
+
+int	main(void)
+{
+	t_env	env;
+	size_t	mallocs;
+	size_t	frees;
+
+	mallocs = unit_malloc_count();
+	frees = unit_free_count();
+	test_basic(&env);
+	test_envp_cache(&env);
+	test_churn(&env);
+	env_destroy(&env);
+	unit_check(unit_malloc_count() - mallocs == unit_free_count() - frees,
+		"destroy releases everything");
+	return (unit_report("env"));
+}
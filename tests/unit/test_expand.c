@@ -0,0 +1,101 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   test_expand.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/27 10:18:44 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/09/27 10:18:44 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "unit.h"
+
+/*
+** Tests for variable resolution: borrowed lookups by (pointer, length),
+** the cached $? text, and words expanding without heap allocation once
+** the scratch buffer and the arena are warm, and words the lexer found
+** nothing to expand in bypassing the expander.
+*/
+
+static void	test_lookup(t_shell *sh)
+{
+	unit_check(!strcmp(shell_var(sh, "USERX", 4), "me")
+		&& shell_var(sh, "USE", 3) == NULL, "lookup by (pointer, length)");
+	unit_check(shell_var(sh, "USER", 4) == env_get(&sh->env, "USER"),
+		"values are borrowed from the environment");
+	sh->last_status = 0;
+	unit_check(!strcmp(shell_status_str(sh), "0"), "$? starts at 0");
+	sh->last_status = 127;
+	unit_check(!strcmp(shell_var(sh, "?", 1), "127"),
+		"$? follows last_status");
+	sh->last_status = -3;
+	unit_check(!strcmp(shell_status_str(sh), "-3"), "negative status");
+}
+
+static void	check_no_alloc(t_shell *sh, const char *raw, const char *want)
+{
+	char	*value;
+	size_t	mallocs;
+
+	value = expand_word_in(&sh->arena, raw, sh);
+	arena_reset(&sh->arena);
+	mallocs = unit_malloc_count();
+	value = expand_word_in(&sh->arena, raw, sh);
+	unit_check(value && !strcmp(value, want)
+		&& unit_malloc_count() == mallocs, raw);
+}
+
+static void	test_bypass(t_shell *sh, const char *line)
+{
+	t_lexer		*lexer;
+	t_parser	*parser;
+	t_pipeline	*list;
+	t_arena		plan;
+
+	ft_bzero(&plan, sizeof(plan));
+	lexer = lexer_init(line);
+	parser = parser_init(lexer, sh);
+	parser->arena = &plan;
+	list = parser_parse(parser);
+	unit_check(list && list->cmds->word_flags[0] == 0
+		&& list->cmds->word_flags[1] == TOKEN_HAS_QUOTE
+		&& list->cmds->word_flags[2] == TOKEN_HAS_DOLLAR
+		&& list->cmds->word_flags[3] == TOKEN_HAS_BACKSLASH
+		&& list->cmds->redirs->flags == 0, "lexer flags reach the words");
+	sh->words_bypassed = 0;
+	sh->words_expanded = 0;
+	unit_check(list && !expand_command(list->cmds, sh)
+		&& list->cmds->argv[0] == list->cmds->words[0]
+		&& list->cmds->redirs->file == list->cmds->redirs->word
+		&& !strcmp(list->cmds->argv[1], "-la") && sh->words_bypassed == 2
+		&& sh->words_expanded == 3, "plain words are used as written");
+	parser_destroy(parser);
+	lexer_destroy(lexer);
+	arena_destroy(&plan);
+}
+
+int	main(void)
+{
+	t_shell	sh;
+	char	*envp[3];
+
+	ft_bzero(&sh, sizeof(sh));
+	envp[0] = "USER=me";
+	envp[1] = "LONG=a fairly long value that is appended in one copy";
+	envp[2] = NULL;
+	if (env_init(&sh.env, envp))
+		return (1);
+	test_lookup(&sh);
+	check_no_alloc(&sh, "$USER", "me");
+	check_no_alloc(&sh, "$?", "-3");
+	check_no_alloc(&sh, "${USER}@\"$LONG\"'$x'$NOPE", "me@a fairly long "
+		"value that is appended in one copy$x");
+	test_bypass(&sh, "ls -l\"a\" $USER a\\b > out");
+	arena_destroy(&sh.arena);
+	env_destroy(&sh.env);
+	free(sh.expand_buf);
+	return (unit_report("expand"));
+}
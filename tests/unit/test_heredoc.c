@@ -0,0 +1,90 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   test_heredoc.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/29 15:48:03 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/09/29 15:48:03 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "unit.h"
+
+/*
+** Tests for heredoc storage: process_heredocs reads a body far larger than
+** a pipe buffer into a seekable fd rewound to its start, for each
+** command of a pipeline, expanding it line by line without allocating.
+*/
+
+#define BODY_LINE "0123456789abcdef0123456789abcdef0123456789abcdef012345678\n"
+#define BODY_LINES 65536
+
+static int	write_script(const char *delimiter)
+{
+	FILE	*script;
+	int		i;
+
+	script = tmpfile();
+	if (!script)
+		return (-1);
+	i = 0;
+	while (i++ < BODY_LINES)
+		fputs(BODY_LINE, script);
+	fprintf(script, "%s\nsmall\n%s\n", delimiter, delimiter);
+	fflush(script);
+	rewind(script);
+	return (dup(fileno(script)));
+}
+
+static void	init_heredoc(t_redir *r, char *delimiter)
+{
+	ft_bzero(r, sizeof(*r));
+	r->type = REDIR_HEREDOC;
+	r->file = delimiter;
+	r->fd = -1;
+}
+
+static void	check_storage(t_redir *big, t_redir *small)
+{
+	struct stat	st;
+
+	unit_check(fstat(big->fd, &st) == 0 && S_ISREG(st.st_mode)
+		&& st.st_size == (off_t)(sizeof(BODY_LINE) - 1) * BODY_LINES,
+		"a 4 MB body is stored whole in a regular file");
+	unit_check(lseek(big->fd, 0, SEEK_CUR) == 0
+		&& lseek(small->fd, 0, SEEK_CUR) == 0, "bodies are rewound");
+	unit_check(fcntl(big->fd, F_GETFD) & FD_CLOEXEC,
+		"storage is not inherited by programs");
+	close(big->fd);
+	close(small->fd);
+}
+
+int	main(void)
+{
+	t_shell		sh;
+	t_redir		big;
+	t_redir		small;
+	size_t		mallocs;
+
+	ft_bzero(&sh, sizeof(sh));
+	if (env_init(&sh.env, (char *[]){"TMPDIR=/tmp", NULL})
+		|| input_open(&sh.input, write_script("EOF")))
+		return (1);
+	init_heredoc(&big, "EOF");
+	init_heredoc(&small, "EOF");
+	big.next = &small;
+	big.expand = 1;
+	mallocs = unit_malloc_count();
+	unit_check(process_heredocs(&big, &sh) == 0 && big.fd >= 0
+		&& small.fd >= 0, "both heredocs are read");
+	unit_check(unit_malloc_count() - mallocs < 8,
+		"65536 expanded lines cost no allocation each");
+	check_storage(&big, &small);
+	input_close(&sh.input);
+	env_destroy(&sh.env);
+	free(sh.expand_buf);
+	return (unit_report("heredoc"));
+}
@@ -0,0 +1,119 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   test_lexer_alloc.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/19 11:20:40 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/09/19 11:20:40 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "unit.h"
+
+/*
+** Allocation-count tests for the span lexer: the input line is borrowed,
+** tokens are spans into it, and token structs come from the lexer arena.
+*/
+
+#define WORD_COUNT 10000
+
+static char	*build_long_line(size_t words)
+{
+	char	*line;
+	size_t	i;
+	size_t	pos;
+
+	line = malloc(words * 12 + 1);
+	if (!line)
+		return (NULL);
+	pos = 0;
+	i = 0;
+	while (i < words)
+	{
+		if (i % 3 == 0)
+			pos += sprintf(line + pos, "'q q' ");
+		else
+			pos += sprintf(line + pos, "word ");
+		i++;
+	}
+	line[pos] = '\0';
+	return (line);
+}
+
+static int	token_is(t_lexer *lexer, t_token *token, t_token_type type,
+		const char *text)
+{
+	return (token && token->type == type
+		&& token->length == ft_strlen(text)
+		&& ft_strncmp(token_text(lexer, token), text, token->length) == 0);
+}
+
+static void	test_spans(void)
+{
+	t_lexer	*lexer;
+	char	*line;
+
+	line = "echo \"a b\" 'c'>>out | x<<EOF";
+	lexer = lexer_init(line);
+	unit_check(lexer && lexer->input == line, "lexer borrows the input line");
+	unit_check(token_is(lexer, lexer_next_token(lexer), TOKEN_WORD, "echo"),
+		"word span");
+	unit_check(token_is(lexer, lexer_next_token(lexer), TOKEN_WORD, "a b"),
+		"double-quoted span excludes quotes");
+	unit_check(token_is(lexer, lexer_next_token(lexer), TOKEN_WORD, "c"),
+		"single-quoted span excludes quotes");
+	unit_check(token_is(lexer, lexer_next_token(lexer), TOKEN_REDIR_APPEND,
+			">>"), "append operator span");
+	unit_check(token_is(lexer, lexer_next_token(lexer), TOKEN_WORD, "out"),
+		"word after operator");
+	unit_check(token_is(lexer, lexer_next_token(lexer), TOKEN_PIPE, "|"),
+		"pipe span");
+	lexer_next_token(lexer);
+	unit_check(token_is(lexer, lexer_next_token(lexer), TOKEN_HEREDOC, "<<"),
+		"heredoc operator span");
+	lexer_next_token(lexer);
+	unit_check(lexer_next_token(lexer)->type == TOKEN_EOF, "EOF token");
+	lexer_destroy(lexer);
+}
+
+static void	test_allocations(void)
+{
+	t_lexer	*lexer;
+	t_token	*token;
+	char	*line;
+	size_t	before;
+	size_t	tokens;
+
+	line = build_long_line(WORD_COUNT);
+	before = unit_malloc_count();
+	lexer = lexer_init(line);
+	unit_check(unit_malloc_count() - before == 1,
+		"lexer_init makes a single allocation (no input copy)");
+	before = unit_malloc_count();
+	tokens = 0;
+	token = lexer_next_token(lexer);
+	while (token && token->type == TOKEN_WORD)
+	{
+		tokens++;
+		token = lexer_next_token(lexer);
+	}
+	unit_check(tokens == WORD_COUNT, "every word is lexed");
+	unit_check(unit_malloc_count() - before
+		<= (tokens + 1) / TOKEN_ARENA_CHUNK + 1,
+		"lexing allocates one arena chunk per TOKEN_ARENA_CHUNK tokens");
+	before = unit_free_count();
+	lexer_destroy(lexer);
+	unit_check(unit_free_count() - before
+		== (tokens + 1) / TOKEN_ARENA_CHUNK + 2,
+		"lexer_destroy releases all chunks and the lexer");
+	free(line);
+}
+
+int	main(void)
+{
+	test_spans();
+	test_allocations();
+	return (unit_report("lexer allocations"));
+}
@@ -0,0 +1,108 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   test_lexer_scan.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/19 10:40:02 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/09/19 10:40:02 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "unit.h"
+
+/*
+** Agreement tests for the lexer character scanners: every vector scanner
+** must stop at the same byte as the scalar table walk, wherever the
+** delimiter falls relative to a 16 or 32 byte block.
+*/
+
+#define SCAN_LEN 100
+
+static int	scanners_agree(const char *s, size_t pos, size_t len)
+{
+	size_t	expect;
+
+	expect = lexer_scan_scalar(s, pos, len);
+	if (lexer_scan_sse2(s, pos, len) != expect)
+		return (0);
+	if (lexer_scan_best() == lexer_scan_avx2
+		&& lexer_scan_avx2(s, pos, len) != expect)
+		return (0);
+	return (lexer_scan(s, pos, len) == expect);
+}
+
+static void	test_each_delimiter(void)
+{
+	char	buf[SCAN_LEN + 1];
+	int		c;
+	size_t	at;
+	int		ok;
+
+	ok = 1;
+	c = 1;
+	while (c < 256)
+	{
+		at = 0;
+		while (at < SCAN_LEN)
+		{
+			memset(buf, 'x', SCAN_LEN);
+			buf[SCAN_LEN] = '\0';
+			buf[at] = (char)c;
+			ok &= scanners_agree(buf, at % 7, SCAN_LEN);
+			at++;
+		}
+		c++;
+	}
+	unit_check(ok, "vector scanners agree with the table for every byte");
+}
+
+static void	test_classes(void)
+{
+	unit_check(lexer_char_class()[' '] == CC_SPACE, "space is CC_SPACE");
+	unit_check(lexer_char_class()['|'] == CC_META, "pipe is CC_META");
+	unit_check(lexer_char_class()['"'] == CC_QUOTE, "dquote is CC_QUOTE");
+	unit_check(lexer_char_class()['$'] == CC_DOLLAR, "dollar is CC_DOLLAR");
+	unit_check(lexer_char_class()['a'] == 0, "letters are unclassified");
+	unit_check(lexer_char_class()[0x80] == 0, "high bytes are unclassified");
+	unit_check(lexer_scan("abc", 0, 3) == 3, "scan stops at len");
+}
+
+static t_token	*last_token(const char *line)
+{
+	static t_lexer	*lexer;
+	t_token			*token;
+
+	lexer_destroy(lexer);
+	lexer = lexer_init(line);
+	token = lexer_next_token(lexer);
+	while (token && token->type != TOKEN_EOF && token->type != TOKEN_ERROR)
+		token = lexer_next_token(lexer);
+	return (token);
+}
+
+static void	test_quotes(void)
+{
+	t_token	*token;
+
+	token = last_token("echo 'a\"b' \"c'd\"");
+	unit_check(token && token->type == TOKEN_EOF,
+		"nested quote chars are closed");
+	token = last_token("echo 'abc");
+	unit_check(token && token->type == TOKEN_ERROR && token->start == 5,
+		"open single quote is an error at its column");
+	token = last_token("echo ok | cat \"a'b'");
+	unit_check(token && token->type == TOKEN_ERROR && token->start == 14,
+		"open double quote is an error at its column");
+	last_token(NULL);
+}
+
+int	main(void)
+{
+	test_classes();
+	test_each_delimiter();
+	test_quotes();
+	return (unit_report("lexer_scan"));
+}
@@ -0,0 +1,173 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   test_output.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/30 15:04:12 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/09/30 15:04:12 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "unit.h"
+
+/*
+** Syscall-count regression tests for builtin output and error reporting:
+** builtins write through shell->out in OUT_BUF_SIZE blocks and flush once
+** when they return, and every error line is a single write(2). Trace
+** events are JSON and a trace that was never opened writes nothing.
+*/
+
+static int	run_builtin(t_shell *shell, char **argv, size_t *writes)
+{
+	t_cmd	cmd;
+	size_t	before;
+	int		status;
+
+	ft_bzero(&cmd, sizeof(cmd));
+	cmd.argv = argv;
+	cmd.builtin = builtin_lookup(argv[0]);
+	before = unit_write_count();
+	status = execute_builtin_in_child(&cmd, shell);
+	*writes = unit_write_count() - before;
+	return (status);
+}
+
+static void	test_echo(t_shell *shell)
+{
+	char	*argv[5];
+	char	text[16];
+	int		fds[2];
+	size_t	writes;
+	ssize_t	n;
+
+	argv[0] = "echo";
+	argv[1] = "a";
+	argv[2] = "b";
+	argv[3] = "c";
+	argv[4] = NULL;
+	if (pipe(fds) == -1)
+		return ;
+	shell->out.fd = fds[1];
+	run_builtin(shell, argv, &writes);
+	close(fds[1]);
+	n = read(fds[0], text, sizeof(text) - 1);
+	close(fds[0]);
+	if (n < 0)
+		n = 0;
+	text[n] = '\0';
+	unit_check(writes == 1 && !strcmp(text, "a b c\n"),
+		"echo a b c is one write");
+}
+
+static void	test_env_listing(t_shell *shell, int devnull)
+{
+	char	*argv[2];
+	char	name[32];
+	size_t	writes;
+	size_t	bytes;
+	int		i;
+
+	i = 0;
+	while (i < 3000)
+	{
+		snprintf(name, sizeof(name), "VARIABLE_%04d", i++);
+		env_set(&shell->env, name, "some value of moderate length");
+	}
+	bytes = 0;
+	i = 0;
+	while (env_envp(&shell->env)[i])
+		bytes += strlen(shell->env.envp[i++]) + 1;
+	argv[0] = "env";
+	argv[1] = NULL;
+	shell->out.fd = devnull;
+	run_builtin(shell, argv, &writes);
+	unit_check(writes <= bytes / (OUT_BUF_SIZE - 64) + 1,
+		"env with 3000 variables writes in OUT_BUF_SIZE blocks");
+	argv[0] = "export";
+	run_builtin(shell, argv, &writes);
+	unit_check(writes < 3000 / 50, "export listing is block-buffered");
+}
+
+static void	test_errors(t_shell *shell, int devnull)
+{
+	char	*argv[2];
+	char	arg[2048];
+	size_t	before;
+
+	before = unit_write_count();
+	print_error("cd", "No such file or directory");
+	print_command_error("nosuchcmd", "command not found");
+	print_arg_error("type", "nosuchcmd", "not found");
+	unit_check(unit_write_count() - before == 3,
+		"each error message is a single write");
+	ft_memset(arg, 'x', sizeof(arg) - 1);
+	arg[sizeof(arg) - 1] = '\0';
+	before = unit_write_count();
+	print_arg_error("hash", arg, "not found");
+	unit_check(unit_write_count() - before == 3,
+		"an argument longer than ERR_LINE_MAX goes out in three writes");
+	argv[0] = "pwd";
+	argv[1] = NULL;
+	shell->out.fd = open("/dev/full", O_WRONLY);
+	unit_check(shell->out.fd == -1 || (run_builtin(shell, argv, &before) == 1
+			&& !shell->out.error && !shell->out.len),
+		"a failed flush makes the builtin fail and resets the buffer");
+	if (shell->out.fd != -1)
+		close(shell->out.fd);
+	shell->out.fd = devnull;
+}
+
+static void	test_trace(void)
+{
+	t_trace		trace;
+	t_outbuf	out;
+	int			fds[2];
+	char		c;
+
+	out_init(&out, -1);
+	trace_put_string(&out, "a\"b\\c\n");
+	unit_check(out.len == 15
+		&& !memcmp(out.data, "\"a\\\"b\\\\c\\u000a\"", 15),
+		"trace names are JSON strings");
+	out.len = 0;
+	trace_put_string(&out, "\xc3\xa9");
+	unit_check(out.len == 14 && !memcmp(out.data, "\"\\u00c3\\u00a9\"", 14),
+		"bytes from 0x80 up are escaped");
+	ft_bzero(&trace, sizeof(trace));
+	if (pipe(fds) == -1)
+		return ;
+	trace.fd = fds[1];
+	trace_event(&trace, "fork", TRACE_BEGIN);
+	trace_child_start(&trace, 1, "ls");
+	trace_child_end(&trace, 1, 0);
+	trace_execve(&trace, 1, "/bin/ls");
+	close(fds[1]);
+	unit_check(read(fds[0], &c, 1) == 0, "a zeroed trace is off");
+	close(fds[0]);
+}
+
+int	main(void)
+{
+	t_shell	shell;
+	int		devnull;
+	int		saved_stderr;
+	char	*envp[1];
+
+	ft_bzero(&shell, sizeof(shell));
+	envp[0] = NULL;
+	env_init(&shell.env, envp);
+	devnull = open("/dev/null", O_WRONLY);
+	saved_stderr = dup(STDERR_FILENO);
+	dup2(devnull, STDERR_FILENO);
+	out_init(&shell.out, devnull);
+	test_echo(&shell);
+	test_env_listing(&shell, devnull);
+	test_errors(&shell, devnull);
+	test_trace();
+	dup2(saved_stderr, STDERR_FILENO);
+	close(saved_stderr);
+	close(devnull);
+	env_destroy(&shell.env);
+	return (unit_report("output"));
+}
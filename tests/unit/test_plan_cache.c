@@ -0,0 +1,120 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   test_plan_cache.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/24 18:02:41 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/09/24 18:02:41 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "unit.h"
+
+/*
+** Tests for the parsed-plan cache: hits skip the parser, least recently
+** used plans are evicted, invalidation and resizing drop stale plans and
+** destroy releases everything.
+*/
+
+static t_pipeline	*cache_line(t_shell *sh, const char *line)
+{
+	t_lexer		*lexer;
+	t_parser	*parser;
+	t_pipeline	*list;
+	t_plan		*plan;
+
+	list = plan_cache_lookup(&sh->plans, line);
+	if (list)
+		return (list);
+	plan = plan_cache_prepare(&sh->plans, line);
+	if (!plan || init_lexer_parser((char *)line, &lexer, &parser, sh))
+		return (plan_free(plan), NULL);
+	parser->arena = &plan->arena;
+	list = parser_parse(parser);
+	parser_destroy(parser);
+	lexer_destroy(lexer);
+	if (!list)
+		return (plan_free(plan), NULL);
+	plan_cache_insert(&sh->plans, plan, list);
+	return (list);
+}
+
+static void	test_hits(t_shell *sh)
+{
+	t_pipeline	*first;
+	size_t		mallocs;
+
+	first = cache_line(sh, "echo a | wc -c && ls");
+	unit_check(first && sh->plans.misses == 1 && sh->plans.count == 1,
+		"first sight is a miss and is cached");
+	mallocs = unit_malloc_count();
+	unit_check(cache_line(sh, "echo a | wc -c && ls") == first
+		&& sh->plans.hits == 1, "same line is a hit");
+	unit_check(unit_malloc_count() == mallocs, "a hit allocates nothing");
+	unit_check(first && !ft_strcmp(first->cmds->next->words[1], "-c")
+		&& first->op == LIST_AND, "cached plan keeps the parse tree");
+	unit_check(cache_line(sh, "echo a | wc -c && l") != first,
+		"different line misses");
+}
+
+static void	test_eviction(t_shell *sh)
+{
+	plan_cache_destroy(&sh->plans);
+	plan_cache_init(&sh->plans, 2);
+	cache_line(sh, "one");
+	cache_line(sh, "two");
+	cache_line(sh, "one");
+	cache_line(sh, "three");
+	unit_check(sh->plans.count == 2 && sh->plans.evictions == 1,
+		"full cache evicts one plan");
+	unit_check(plan_cache_lookup(&sh->plans, "one") != NULL,
+		"recently used plan survives");
+	unit_check(plan_cache_lookup(&sh->plans, "two") == NULL,
+		"least recently used plan is evicted");
+	plan_cache_invalidate(&sh->plans);
+	unit_check(plan_cache_lookup(&sh->plans, "one") == NULL
+		&& sh->plans.count == 1, "invalidated plans are dropped on lookup");
+}
+
+static void	test_resize(t_shell *sh)
+{
+	unit_check(plan_cache_size_from(NULL) == PLAN_CACHE_DEFAULT_SIZE
+		&& plan_cache_size_from("12x") == PLAN_CACHE_DEFAULT_SIZE
+		&& plan_cache_size_from("0") == 0
+		&& plan_cache_size_from("99999999999") == PLAN_CACHE_MAX_SIZE,
+		"PLAN_CACHE_SIZE is parsed and clamped");
+	cache_line(sh, "three");
+	plan_cache_env_changed(&sh->plans, "PLAN_CACHE_SIZEX", "0");
+	unit_check(sh->plans.resize_to == 0, "other variables are ignored");
+	plan_cache_env_changed(&sh->plans, PLAN_CACHE_SIZE_VAR, "0");
+	unit_check(sh->plans.count == 1, "resize waits for the next lookup");
+	unit_check(cache_line(sh, "three") == NULL && sh->plans.count == 0
+		&& sh->plans.capacity == 0, "size 0 disables the cache");
+	plan_cache_env_changed(&sh->plans, PLAN_CACHE_SIZE_VAR, "8");
+	cache_line(sh, "three");
+	unit_check(sh->plans.capacity == 8 && sh->plans.count == 1,
+		"cache can be re-enabled");
+}
+
+int	main(void)
+{
+	t_shell	sh;
+	size_t	mallocs;
+	size_t	frees;
+
+	ft_bzero(&sh, sizeof(sh));
+	mallocs = unit_malloc_count();
+	frees = unit_free_count();
+	plan_cache_init(&sh.plans, PLAN_CACHE_DEFAULT_SIZE);
+	test_hits(&sh);
+	test_eviction(&sh);
+	test_resize(&sh);
+	plan_cache_destroy(&sh.plans);
+	arena_destroy(&sh.arena);
+	unit_check(unit_malloc_count() - mallocs == unit_free_count() - frees,
+		"destroy releases every plan");
+	return (unit_report("plan_cache"));
+}
@@ -0,0 +1,209 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   test_redir_plan.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/10/01 13:15:40 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/10/01 13:15:40 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "unit.h"
+
+/*
+** Tests for the redirection planner: parent builtins save and restore
+** only the fds they redirect, a target redirected several times gets one
+** dup2, fd swaps resolve, failed plans leave no fd open, and pipe ends
+** seeded for a pipeline stage come before the command's redirections.
+*/
+
+static t_redir	*redir_at(t_redir *r, t_redir_type type, int io_fd,
+		char *file)
+{
+	ft_bzero(r, sizeof(*r));
+	r->type = type;
+	r->io_fd = io_fd;
+	r->file = file;
+	r->fd = -1;
+	return (r);
+}
+
+static void	test_builtin_dup2s(t_shell *shell, const char *dir)
+{
+	t_cmd	cmd;
+	t_redir	r;
+	char	*argv[3];
+	char	path[PATH_MAX];
+	size_t	before;
+
+	argv[0] = "unset";
+	argv[1] = "NOPE";
+	argv[2] = NULL;
+	ft_bzero(&cmd, sizeof(cmd));
+	cmd.argv = argv;
+	cmd.builtin = BUILTIN_UNSET;
+	before = unit_dup2_count();
+	unit_check(execute_builtin_with_redirections(&cmd, shell) == 0
+		&& unit_dup2_count() == before, "no redirections, no dup2");
+	snprintf(path, sizeof(path), "%s/err", dir);
+	cmd.redirs = redir_at(&r, REDIR_OUT, STDERR_FILENO, path);
+	before = unit_dup2_count();
+	unit_check(execute_builtin_with_redirections(&cmd, shell) == 0
+		&& unit_dup2_count() - before == 2,
+		"2>file touches only fd 2: one dup2 in, one back");
+	unlink(path);
+}
+
+static void	test_last_target(const char *dir)
+{
+	t_redir_plan	plan;
+	t_redir			r[3];
+	char			path[3][PATH_MAX];
+	struct stat		st[3];
+	size_t			before;
+
+	snprintf(path[0], PATH_MAX, "%s/a", dir);
+	snprintf(path[1], PATH_MAX, "%s/b", dir);
+	snprintf(path[2], PATH_MAX, "%s/c", dir);
+	redir_at(&r[0], REDIR_OUT, 5, path[0])->next = &r[1];
+	redir_at(&r[1], REDIR_OUT, 5, path[1])->next = &r[2];
+	redir_at(&r[2], REDIR_APPEND, 5, path[2]);
+	before = unit_dup2_count();
+	if (redir_plan_build(&plan, r) || redir_plan_save(&plan)
+		|| redir_plan_apply(&plan))
+	{
+		unit_check(0, "> a > b >> c is planned");
+		return ;
+	}
+	write(5, "x", 1);
+	redir_plan_restore(&plan);
+	unit_check(unit_dup2_count() - before == 1 && fcntl(5, F_GETFD) == -1,
+		"> a > b >> c: one dup2, fd 5 closed again");
+	unit_check(!stat(path[0], &st[0]) && !stat(path[1], &st[1])
+		&& !stat(path[2], &st[2]) && st[0].st_size == 0
+		&& st[1].st_size == 0 && st[2].st_size == 1,
+		"every file is created, only the last one is written");
+	unlink(path[0]);
+	unlink(path[1]);
+	unlink(path[2]);
+}
+
+static void	test_swap(const char *dir)
+{
+	t_redir_plan	plan;
+	t_redir			r[3];
+	struct stat		st[3];
+	struct stat		orig[2];
+	char			path[PATH_MAX];
+
+	snprintf(path, sizeof(path), "%s/five", dir);
+	dup2(open(path, O_WRONLY | O_CREAT | O_CLOEXEC, 0644), 5);
+	snprintf(path, sizeof(path), "%s/six", dir);
+	dup2(open(path, O_WRONLY | O_CREAT | O_CLOEXEC, 0644), 6);
+	fstat(5, &orig[0]);
+	fstat(6, &orig[1]);
+	redir_at(&r[0], REDIR_DUP_OUT, 7, "5")->next = &r[1];
+	redir_at(&r[1], REDIR_DUP_OUT, 5, "6")->next = &r[2];
+	redir_at(&r[2], REDIR_DUP_OUT, 6, "7");
+	unit_check(!redir_plan_build(&plan, r) && !redir_plan_save(&plan)
+		&& !redir_plan_apply(&plan) && !fstat(5, &st[0]) && !fstat(6, &st[1])
+		&& !fstat(7, &st[2]) && st[0].st_ino == orig[1].st_ino
+		&& st[1].st_ino == orig[0].st_ino && st[2].st_ino == orig[0].st_ino,
+		"7>&5 5>&6 6>&7 swaps fds 5 and 6");
+	redir_plan_restore(&plan);
+	unit_check(!fstat(5, &st[0]) && !fstat(6, &st[1])
+		&& st[0].st_ino == orig[0].st_ino && st[1].st_ino == orig[1].st_ino
+		&& fcntl(7, F_GETFD) == -1, "restore puts both back, closes 7");
+	close(5);
+	close(6);
+	unlink(path);
+	snprintf(path, sizeof(path), "%s/five", dir);
+	unlink(path);
+}
+
+static void	test_errors(const char *dir)
+{
+	t_redir_plan	plan;
+	t_redir			r[2];
+	char			path[PATH_MAX];
+	int				next_fd;
+
+	next_fd = dup(0);
+	close(next_fd);
+	snprintf(path, sizeof(path), "%s/x", dir);
+	redir_at(&r[0], REDIR_OUT, 4, path)->next = &r[1];
+	redir_at(&r[1], REDIR_DUP_OUT, 3, "9");
+	unit_check(redir_plan_build(&plan, r) == 1, "9 is not open");
+	redir_at(&r[1], REDIR_DUP_IN, 0, "zz");
+	unit_check(redir_plan_build(&plan, r) == 1, "<&zz is ambiguous");
+	redir_at(&r[1], REDIR_OUT, 12, path);
+	unit_check(redir_plan_build(&plan, r) == 1, "fd 12 is refused");
+	redir_at(&r[1], REDIR_DUP_OUT, 3, ft_itoa(next_fd));
+	unit_check(redir_plan_build(&plan, r) == 1,
+		"fds the plan opened itself cannot be duplicated");
+	free(r[1].file);
+	unit_check(dup(0) == next_fd, "failed plans close what they opened");
+	close(next_fd);
+	unlink(path);
+}
+
+static void	test_pipe(const char *dir)
+{
+	t_redir_plan	plan;
+	t_redir			r;
+	char			path[PATH_MAX];
+	int				fds[2];
+
+	if (pipe(fds))
+		return ;
+	redir_plan_pipe(&plan, fds[0], fds[1]);
+	redir_at(&r, REDIR_DUP_OUT, STDERR_FILENO, "1");
+	unit_check(!redir_plan_add(&plan, &r)
+		&& plan.source[STDIN_FILENO] == fds[0]
+		&& plan.source[STDERR_FILENO] == fds[1],
+		"2>&1 in a stage is the pipe");
+	redir_plan_discard(&plan);
+	unit_check(fcntl(fds[0], F_GETFD) == -1 && fcntl(fds[1], F_GETFD) == -1,
+		"the plan owns the pipe ends");
+	if (pipe(fds))
+		return ;
+	snprintf(path, sizeof(path), "%s/in", dir);
+	close(open(path, O_WRONLY | O_CREAT, 0644));
+	redir_plan_pipe(&plan, fds[0], -1);
+	redir_at(&r, REDIR_IN, STDIN_FILENO, path);
+	unit_check(!redir_plan_add(&plan, &r) && fcntl(fds[0], F_GETFD) == -1,
+		"< file closes the pipe it replaces at once");
+	redir_plan_discard(&plan);
+	close(fds[1]);
+	unlink(path);
+}
+
+int	main(void)
+{
+	t_shell	shell;
+	char	dir[32];
+	char	*envp[1];
+	int		saved_stderr;
+
+	ft_bzero(&shell, sizeof(shell));
+	envp[0] = NULL;
+	env_init(&shell.env, envp);
+	out_init(&shell.out, STDOUT_FILENO);
+	ft_strlcpy(dir, "/tmp/redir_plan_XXXXXX", sizeof(dir));
+	if (!mkdtemp(dir))
+		return (1);
+	saved_stderr = fcntl(STDERR_FILENO, F_DUPFD_CLOEXEC, 10);
+	close(STDERR_FILENO);
+	open("/dev/null", O_WRONLY);
+	test_builtin_dup2s(&shell, dir);
+	test_last_target(dir);
+	test_swap(dir);
+	test_errors(dir);
+	test_pipe(dir);
+	dup2(saved_stderr, STDERR_FILENO);
+	close(saved_stderr);
+	rmdir(dir);
+	env_destroy(&shell.env);
+	return (unit_report("redir_plan"));
+}
@@ -0,0 +1,141 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   test_stages.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/10/06 15:27:48 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/10/06 15:27:48 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "unit.h"
+
+/*
+** Tests for the pipeline stage record: its table only allocates when a
+** longer pipeline comes, $PIPESTATUS and pipefail read the statuses, and
+** times are printed as seconds and as the JSON report of time.
+*/
+
+static void	set_statuses(t_stages *stages, t_cmd *cmds, const int *statuses,
+		size_t n)
+{
+	size_t	i;
+
+	i = 0;
+	while (i < n)
+	{
+		ft_bzero(&cmds[i], sizeof(t_cmd));
+		if (i + 1 < n)
+			cmds[i].next = &cmds[i + 1];
+		i++;
+	}
+	stages_begin(stages, cmds);
+	i = 0;
+	while (i < n)
+		stages_add(stages)->status = statuses[i++];
+}
+
+static void	test_table(void)
+{
+	t_stages	stages;
+	t_cmd		cmds[3];
+	size_t		before;
+
+	ft_bzero(&stages, sizeof(stages));
+	before = unit_malloc_count();
+	set_statuses(&stages, cmds, (int []){0, 1, 0}, 3);
+	unit_check(unit_malloc_count() - before == 2 && stages.cap == 3,
+		"a first pipeline allocates the table and its text");
+	before = unit_malloc_count();
+	set_statuses(&stages, cmds, (int []){0, 0}, 2);
+	unit_check(unit_malloc_count() == before && stages.count == 2,
+		"a shorter one reuses them");
+	stages_clear(&stages);
+}
+
+static void	test_status(void)
+{
+	t_stages	stages;
+	t_cmd		cmds[3];
+
+	ft_bzero(&stages, sizeof(stages));
+	set_statuses(&stages, cmds, (int []){0, 1, 0}, 3);
+	unit_check(!strcmp(stages_status_str(&stages), "0 1 0"),
+		"PIPESTATUS lists every stage");
+	unit_check(stages_result(&stages, 0) == 0
+		&& stages_result(&stages, 1) == 1,
+		"pipefail returns the last failing stage");
+	set_statuses(&stages, cmds, (int []){141, 255, 127}, 3);
+	unit_check(!strcmp(stages_status_str(&stages), "141 255 127")
+		&& stages_result(&stages, 1) == 127, "three-digit statuses");
+	set_statuses(&stages, cmds, (int []){0, 0}, 2);
+	unit_check(stages_result(&stages, 1) == 0, "no failure, pipefail is 0");
+	stages_clear(&stages);
+	unit_check(!strcmp(stages_status_str(&stages), ""),
+		"no pipeline ran yet");
+}
+
+static int	seconds_are(long usec, int precision, const char *expected)
+{
+	t_outbuf	out;
+
+	out_init(&out, -1);
+	out_putseconds(&out, usec, precision);
+	return (out.len == strlen(expected)
+		&& !memcmp(out.data, expected, out.len));
+}
+
+static void	test_seconds(void)
+{
+	t_outbuf	out;
+
+	unit_check(seconds_are(1250000, 3, "1.250") && seconds_are(1250000, 0, "1")
+		&& seconds_are(999, 3, "0.000") && seconds_are(5000001, 6, "5.000001")
+		&& seconds_are(61999999, 2, "61.99"), "seconds are truncated");
+	out_init(&out, -1);
+	out_putnbr(&out, -42);
+	out_putnbr(&out, 0);
+	unit_check(out.len == 4 && !memcmp(out.data, "-420", 4), "out_putnbr");
+}
+
+static void	test_time(void)
+{
+	t_stages	stages;
+	t_cmd		cmds[2];
+	t_times		times;
+	t_outbuf	out;
+	const char	*json;
+
+	ft_bzero(&stages, sizeof(stages));
+	set_statuses(&stages, cmds, (int []){141, 0}, 2);
+	stages.items[0].utime.tv_usec = 1500;
+	stages.items[1].stime.tv_sec = 2;
+	stages_times(&stages, &times);
+	unit_check(times.user == 1500 && times.sys == 2000000,
+		"time adds up the CPU time of the stages");
+	times.real = 62500000;
+	out_init(&out, -1);
+	time_put(&out, times.real, -1, 1);
+	unit_check(out.len == 8 && !memcmp(out.data, "1m2.500s", 8),
+		"long form");
+	json = "{\"real\":62.5,\"user\":0.0,\"sys\":2.0,\"stages\":["
+		"{\"pid\":0,\"status\":141,\"real\":0.0,\"user\":0.0,\"sys\":0.0,"
+		"\"maxrss\":0},{\"pid\":0,\"status\":0,\"real\":0.0,\"user\":0.0,"
+		"\"sys\":2.0,\"maxrss\":0}]}";
+	out_init(&out, -1);
+	time_put_json(&out, &times, &stages, 1);
+	unit_check(out.len == strlen(json) && !memcmp(out.data, json, out.len),
+		"JSON report");
+	stages_clear(&stages);
+}
+
+int	main(void)
+{
+	test_table();
+	test_status();
+	test_seconds();
+	test_time();
+	return (unit_report("stages"));
+}
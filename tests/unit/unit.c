@@ -0,0 +1,90 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   unit.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/19 11:02:17 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/09/19 11:02:17 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "unit.h"
+
+void	*__real_malloc(size_t size);
+void	__real_free(void *ptr);
+ssize_t	__real_write(int fd, const void *buf, size_t len);
+int		__real_dup2(int fd, int target);
+
+static size_t	g_mallocs;
+static size_t	g_frees;
+static size_t	g_writes;
+static size_t	g_dup2s;
+static int		g_passed;
+static int		g_failed;
+
+void	*__wrap_malloc(size_t size)
+{
+	g_mallocs++;
+	return (__real_malloc(size));
+}
+
+void	__wrap_free(void *ptr)
+{
+	if (ptr)
+		g_frees++;
+	__real_free(ptr);
+}
+
+ssize_t	__wrap_write(int fd, const void *buf, size_t len)
+{
+	g_writes++;
+	return (__real_write(fd, buf, len));
+}
+
+int	__wrap_dup2(int fd, int target)
+{
+	g_dup2s++;
+	return (__real_dup2(fd, target));
+}
+
+size_t	unit_malloc_count(void)
+{
+	return (g_mallocs);
+}
+
+size_t	unit_free_count(void)
+{
+	return (g_frees);
+}
+
+size_t	unit_write_count(void)
+{
+	return (g_writes);
+}
+
+size_t	unit_dup2_count(void)
+{
+	return (g_dup2s);
+}
+
+void	unit_check(int condition, const char *description)
+{
+	if (condition)
+	{
+		printf("\033[0;32m[PASS]\033[0m %s\n", description);
+		g_passed++;
+	}
+	else
+	{
+		printf("\033[0;31m[FAIL]\033[0m %s\n", description);
+		g_failed++;
+	}
+}
+
+int	unit_report(const char *suite)
+{
+	printf("%s: %d passed, %d failed\n", suite, g_passed, g_failed);
+	return (g_failed != 0);
+}
@@ -0,0 +1,32 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   unit.h                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tmarcos <tmarcos@student.42berlin.de>      +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/09/19 11:02:17 by tmarcos           #+#    #+#             */
+/*   Updated: 2025/09/19 11:02:17 by tmarcos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef UNIT_H
+# define UNIT_H
+
+# include "minishell.h"
+
+/*
+** Minimal helpers for the C unit tests in tests/unit.
+** Test binaries are linked with -Wl,--wrap=malloc,--wrap=free,--wrap=write
+** and --wrap=dup2 so every allocation, write(2) and dup2(2) made by the
+** shell objects and libft is counted.
+*/
+
+size_t	unit_malloc_count(void);
+size_t	unit_free_count(void);
+size_t	unit_write_count(void);
+size_t	unit_dup2_count(void);
+void	unit_check(int condition, const char *description);
+int		unit_report(const char *suite);
+
+#endif